@@ -36,11 +36,15 @@ FastNoiseSIMD::FastNoiseSIMD() {
 	set_offset(Vector3(0.0, 0.0, 0.0));
 	set_axis_scales(Vector3(1.0, 1.0, 1.0));
 	set_scale(1.0);
+	set_sample_interp(SAMPLE_LINEAR);
+	set_precision(PRECISION_EXACT);
 
 	set_fractal_type(FRACTAL_FBM);
 	set_fractal_octaves(3);
 	set_fractal_lacunarity(2.0);
 	set_fractal_gain(0.5);
+	set_fractal_offset(1.0);
+	set_fractal_feedback(2.0);
 
 	set_cellular_distance_function(DISTANCE_EUCLIDEAN);
 	set_cellular_return_type(RETURN_CELL_VALUE);
@@ -50,6 +54,8 @@ FastNoiseSIMD::FastNoiseSIMD() {
 	set_perturb_type(PERTURB_NONE);
 	set_perturb_amplitude(1);
 	set_perturb_frequency(0.5);
+	set_perturb_kernel(PERTURB_KERNEL_LATTICE);
+	set_perturb_sample_ratio(1);
 	set_perturb_fractal_octaves(3);
 	set_perturb_fractal_lacunarity(2.0);
 	set_perturb_fractal_gain(0.5);
@@ -61,6 +67,7 @@ FastNoiseSIMD::~FastNoiseSIMD() {
 		_noise->FreeNoiseSet(_allocated_sets.front()->get());
 		_allocated_sets.pop_front();
 	}
+	_noise->FreeNoiseSet(_sample_scratch);
 	delete _noise;
 }
 
@@ -124,6 +131,24 @@ float FastNoiseSIMD::get_scale() const {
 	return _scale;
 }
 
+void FastNoiseSIMD::set_sample_interp(SampleInterp p_interp) {
+	_noise->SetSampleInterp((_FastNoiseSIMD::SampleInterp)p_interp);
+	emit_changed();
+}
+
+FastNoiseSIMD::SampleInterp FastNoiseSIMD::get_sample_interp() const {
+	return (SampleInterp)_noise->GetSampleInterp();
+}
+
+void FastNoiseSIMD::set_precision(Precision p_precision) {
+	_noise->SetPrecision((_FastNoiseSIMD::Precision)p_precision);
+	emit_changed();
+}
+
+FastNoiseSIMD::Precision FastNoiseSIMD::get_precision() const {
+	return (Precision)_noise->GetPrecision();
+}
+
 int FastNoiseSIMD::get_simd_level() const {
 	return _noise->GetSIMDLevel();
 }
@@ -135,10 +160,17 @@ float FastNoiseSIMD::get_noise_1d(float p_z) {
 }
 
 float FastNoiseSIMD::get_noise_2dv(Vector2 p_v) {
-	return get_noise_3d(p_v.x, 0.0, p_v.y);
+	return get_noise_2d(p_v.x, p_v.y);
 }
 
 float FastNoiseSIMD::get_noise_2d(float p_x, float p_z) {
+	// 2D cellular only searches the neighboring cells in the X/Z plane
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		float *n = _noise->GetCellular2DSet(p_x + _offset.x, p_z + _offset.z, 1.0, 1.0);
+		float v = *n;
+		_noise->FreeNoiseSet(n);
+		return v;
+	}
 	return get_noise_3d(p_x, 0.0, p_z);
 }
 
@@ -160,10 +192,16 @@ float *FastNoiseSIMD::get_noise_set_1d(float p_z, int p_sizez, float p_scale) {
 }
 
 float *FastNoiseSIMD::get_noise_set_2dv(Vector2 p_v, Vector2 p_size, float p_scale) {
-	return get_noise_set_3d(p_v.x, 0.0, p_v.y, p_size.x, 1.0, p_size.y, p_scale);
+	return get_noise_set_2d(p_v.x, p_v.y, p_size.x, p_size.y, p_scale);
 }
 
 float *FastNoiseSIMD::get_noise_set_2d(float p_x, float p_z, int p_sizex, int p_sizez, float p_scale) {
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		float scale = (p_scale == 0.0) ? _scale : p_scale;
+		float *ns = _noise->GetCellular2DSet(p_x + _offset.x, p_z + _offset.z, p_sizex, p_sizez, scale);
+		_allocated_sets.push_back(ns);
+		return ns;
+	}
 	return get_noise_set_3d(p_x, 0.0, p_z, p_sizex, 1.0, p_sizez, p_scale);
 }
 
@@ -204,6 +242,87 @@ void FastNoiseSIMD::free_noise_set(float *p_set) {
 	_noise->FreeNoiseSet(p_set);
 }
 
+// Chunk set functions
+
+float *FastNoiseSIMD::get_noise_chunk_3dv(Vector3 p_v, Vector3 p_size, int p_apron, float p_scale) {
+	float *ns;
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	ns = _noise->GetChunkSet(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, p_apron, &_chunk_cache, scale);
+	_allocated_sets.push_back(ns);
+	return ns;
+}
+
+// Threshold set functions
+
+float *FastNoiseSIMD::get_threshold_set_3dv(Vector3 p_v, Vector3 p_size, float p_iso_level, float p_scale) {
+	float *ns;
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	ns = _noise->GetThresholdSet(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, p_iso_level, scale);
+	_allocated_sets.push_back(ns);
+	return ns;
+}
+
+// Sampled set functions
+
+float *FastNoiseSIMD::_get_sample_scratch(Vector3 p_v, Vector3 p_size, Vector3 p_ratio) {
+	ERR_FAIL_COND_V_MSG(p_ratio.x < 1 || p_ratio.y < 1 || p_ratio.z < 1, nullptr, "Sample ratios must be at least 1 on every axis.");
+	int size = _noise->GetSampledScratchSize(p_v.x, p_v.y, p_v.z, p_size.x, p_size.y, p_size.z, p_ratio.x, p_ratio.y, p_ratio.z);
+	if (size > _sample_scratch_size) {
+		_noise->FreeNoiseSet(_sample_scratch);
+		_sample_scratch = _noise->GetEmptySet(size);
+		_sample_scratch_size = size;
+	}
+	return _sample_scratch;
+}
+
+float *FastNoiseSIMD::get_noise_set_sampled_3dv(Vector3 p_v, Vector3 p_size, Vector3 p_ratio, float p_scale) {
+	ERR_FAIL_COND_V_MSG(p_ratio.x < 1 || p_ratio.y < 1 || p_ratio.z < 1, nullptr, "Sample ratios must be at least 1 on every axis.");
+	float *ns;
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	Vector3 v = p_v + _offset;
+	ns = _noise->GetEmptySet(p_size.x, p_size.y, p_size.z);
+	_noise->FillSampledNoiseSet(ns, v.x, v.y, v.z, p_size.x, p_size.y, p_size.z, p_ratio.x, p_ratio.y, p_ratio.z, _get_sample_scratch(v, p_size, p_ratio), scale);
+	_allocated_sets.push_back(ns);
+	return ns;
+}
+
+// Tile hash sets
+
+Vector<int32_t> FastNoiseSIMD::get_tile_hash_set_2dv(Vector2 p_v, Vector2 p_size) {
+	int *hs = _noise->GetTileHash2DSet(p_v.x + _offset.x, p_v.y + _offset.z, p_size.x, p_size.y);
+
+	Vector<int32_t> ids;
+	int size = p_size.x * p_size.y;
+	ids.resize(size);
+	memcpy(ids.ptrw(), hs, size * sizeof(int32_t));
+
+	_noise->FreeIntSet(hs);
+	return ids;
+}
+
+Vector<int32_t> FastNoiseSIMD::get_tile_hash_set_3dv(Vector3 p_v, Vector3 p_size) {
+	int *hs = _noise->GetTileHashSet(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z);
+
+	Vector<int32_t> ids;
+	int size = p_size.x * p_size.y * p_size.z;
+	ids.resize(size);
+	memcpy(ids.ptrw(), hs, size * sizeof(int32_t));
+
+	_noise->FreeIntSet(hs);
+	return ids;
+}
+
+// Bounds functions
+
+Vector2 FastNoiseSIMD::get_noise_bounds_3dv(Vector3 p_v, Vector3 p_size, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	float min, max;
+	if (!_noise->GetNoiseBounds(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, min, max, scale)) {
+		return Vector2(-Math_INF, Math_INF);
+	}
+	return Vector2(min, max);
+}
+
 // Allocate PoolVectors for GDScript
 
 Vector<float> FastNoiseSIMD::_b_get_noise_set_1d(float p_z, int p_sizez, float p_scale) {
@@ -221,7 +340,12 @@ Vector<float> FastNoiseSIMD::_b_get_noise_set_1d(float p_z, int p_sizez, float p
 
 Vector<float> FastNoiseSIMD::_b_get_noise_set_2dv(Vector2 p_v, Vector2 p_size, float p_scale) {
 	float scale = (p_scale == 0.0) ? _scale : p_scale;
-	float *ns = _noise->GetNoiseSet(p_v.x + _offset.x, 0.f, p_v.y + _offset.z, p_size.x, 1.f, p_size.y, scale);
+	float *ns;
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		ns = _noise->GetCellular2DSet(p_v.x + _offset.x, p_v.y + _offset.z, p_size.x, p_size.y, scale);
+	} else {
+		ns = _noise->GetNoiseSet(p_v.x + _offset.x, 0.f, p_v.y + _offset.z, p_size.x, 1.f, p_size.y, scale);
+	}
 
 	Vector<float> pv;
 	int size = p_size.x * p_size.y;
@@ -247,6 +371,157 @@ Vector<float> FastNoiseSIMD::_b_get_noise_set_3dv(Vector3 p_v, Vector3 p_size, f
 	return pv;
 }
 
+Vector<float> FastNoiseSIMD::_b_get_noise_chunk_3dv(Vector3 p_v, Vector3 p_size, int p_apron, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	float *ns = _noise->GetChunkSet(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, p_apron, &_chunk_cache, scale);
+
+	Vector<float> pv;
+	int size = (p_size.x + p_apron * 2) * (p_size.y + p_apron * 2) * (p_size.z + p_apron * 2);
+	pv.resize(size);
+	float *wr = pv.ptrw();
+	memcpy(wr, ns, size * sizeof(float));
+
+	_noise->FreeNoiseSet(ns);
+	return pv;
+}
+
+Vector<float> FastNoiseSIMD::_b_get_noise_set_sampled_3dv(Vector3 p_v, Vector3 p_size, Vector3 p_ratio, float p_scale) {
+	ERR_FAIL_COND_V_MSG(p_ratio.x < 1 || p_ratio.y < 1 || p_ratio.z < 1, Vector<float>(), "Sample ratios must be at least 1 on every axis.");
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	Vector3 v = p_v + _offset;
+
+	Vector<float> pv;
+	int size = p_size.x * p_size.y * p_size.z;
+	pv.resize(size);
+	float *wr = pv.ptrw();
+	_noise->FillSampledNoiseSet(wr, v.x, v.y, v.z, p_size.x, p_size.y, p_size.z, p_ratio.x, p_ratio.y, p_ratio.z, _get_sample_scratch(v, p_size, p_ratio), scale);
+
+	return pv;
+}
+
+Vector<uint8_t> FastNoiseSIMD::_b_get_threshold_set_3dv(Vector3 p_v, Vector3 p_size, float p_iso_level, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	float *ns = _noise->GetThresholdSet(p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, p_iso_level, scale);
+
+	Vector<uint8_t> pv;
+	int size = p_size.x * p_size.y * p_size.z;
+	pv.resize(size);
+	uint8_t *wr = pv.ptrw();
+	for (int i = 0; i < size; i++) {
+		wr[i] = ns[i] > 0.0f;
+	}
+
+	_noise->FreeNoiseSet(ns);
+	return pv;
+}
+
+// Cellular cell sets
+
+Array FastNoiseSIMD::get_cell_set_3dv(Vector3 p_v, Vector3 p_size, bool p_points, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	int size = p_size.x * p_size.y * p_size.z;
+	int plane_size = _noise->AlignedSize(size);
+
+	int *cs = _noise->GetEmptyIntSet(size);
+	float *ps = p_points ? _noise->GetEmptySet(plane_size * 3) : nullptr;
+	float *ps2 = p_points ? _noise->GetEmptySet(plane_size * 3) : nullptr;
+	_noise->FillCellularCellSet(cs, ps, ps2, p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, scale);
+
+	Array result;
+	Vector<int32_t> ids;
+	ids.resize(size);
+	memcpy(ids.ptrw(), cs, size * sizeof(int32_t));
+	result.push_back(ids);
+	_noise->FreeIntSet(cs);
+
+	if (p_points) {
+		Vector<Vector3> points;
+		Vector<Vector3> points2;
+		points.resize(size);
+		points2.resize(size);
+		Vector3 *wr = points.ptrw();
+		Vector3 *wr2 = points2.ptrw();
+		for (int i = 0; i < size; i++) {
+			wr[i] = Vector3(ps[i], ps[plane_size + i], ps[plane_size * 2 + i]) - _offset;
+			wr2[i] = Vector3(ps2[i], ps2[plane_size + i], ps2[plane_size * 2 + i]) - _offset;
+		}
+		result.push_back(points);
+		result.push_back(points2);
+		_noise->FreeNoiseSet(ps);
+		_noise->FreeNoiseSet(ps2);
+	}
+	return result;
+}
+
+// Warped sets
+
+Vector<Vector3> FastNoiseSIMD::get_warped_set_3dv(Vector3 p_v, Vector3 p_size, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	int size = p_size.x * p_size.y * p_size.z;
+
+	FastNoiseVectorSet ws;
+	_noise->FillWarpedVectorSet(&ws, p_v.x + _offset.x, p_v.y + _offset.y, p_v.z + _offset.z, p_size.x, p_size.y, p_size.z, scale);
+
+	Vector<Vector3> points;
+	points.resize(size);
+	Vector3 *wr = points.ptrw();
+	for (int i = 0; i < size; i++) {
+		wr[i] = Vector3(ws.xSet[i], ws.ySet[i], ws.zSet[i]) - _offset;
+	}
+	return points;
+}
+
+Vector<Vector3> FastNoiseSIMD::warp_points(const Vector<Vector3> &p_points) {
+	int size = p_points.size();
+
+	FastNoiseVectorSet vs(size);
+	const Vector3 *rd = p_points.ptr();
+	for (int i = 0; i < size; i++) {
+		vs.xSet[i] = rd[i].x;
+		vs.ySet[i] = rd[i].y;
+		vs.zSet[i] = rd[i].z;
+	}
+
+	// Warped in place, the offset is applied for sampling and taken off again
+	_noise->FillWarpedVectorSet(&vs, &vs, _offset.x, _offset.y, _offset.z);
+
+	Vector<Vector3> points;
+	points.resize(size);
+	Vector3 *wr = points.ptrw();
+	for (int i = 0; i < size; i++) {
+		wr[i] = Vector3(vs.xSet[i], vs.ySet[i], vs.zSet[i]);
+	}
+	return points;
+}
+
+// Height maps
+
+Array FastNoiseSIMD::get_height_map_2dv(Vector2 p_v, Vector2 p_size, float p_height_scale, float p_height_bias, float p_scale) {
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+	int size = p_size.x * p_size.y;
+	float min, max;
+
+	// Scaled and biased as the noise is generated, straight into the array
+	Vector<float> heights;
+	heights.resize(size);
+	float *wr = heights.ptrw();
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		float *ns = _noise->GetCellular2DSet(p_v.x + _offset.x, p_v.y + _offset.z, p_size.x, p_size.y, scale);
+		min = Math_INF;
+		max = -Math_INF;
+		_noise->ConvertToHeights(wr, ns, size, p_height_scale, p_height_bias, min, max);
+		_noise->FreeNoiseSet(ns);
+	} else {
+		_noise->FillHeightMap(wr, p_v.x + _offset.x, _offset.y, p_v.y + _offset.z, p_size.x, p_size.y, p_height_scale, p_height_bias, min, max, 0, scale);
+	}
+
+	Array result;
+	result.push_back(heights);
+	result.push_back(min);
+	result.push_back(max);
+	return result;
+}
+
 // Perturb
 
 void FastNoiseSIMD::set_perturb_type(PerturbType p_type) {
@@ -278,6 +553,24 @@ float FastNoiseSIMD::get_perturb_frequency() const {
 	return _noise->GetPerturbFrequency();
 }
 
+void FastNoiseSIMD::set_perturb_kernel(PerturbKernel p_kernel) {
+	_noise->SetPerturbKernel((_FastNoiseSIMD::PerturbKernel)p_kernel);
+	emit_changed();
+}
+
+FastNoiseSIMD::PerturbKernel FastNoiseSIMD::get_perturb_kernel() const {
+	return (PerturbKernel)_noise->GetPerturbKernel();
+}
+
+void FastNoiseSIMD::set_perturb_sample_ratio(int p_ratio) {
+	_noise->SetPerturbSampleRatio(p_ratio);
+	emit_changed();
+}
+
+int FastNoiseSIMD::get_perturb_sample_ratio() const {
+	return _noise->GetPerturbSampleRatio();
+}
+
 void FastNoiseSIMD::set_perturb_fractal_octaves(int p_octaves) {
 	_noise->SetPerturbFractalOctaves(p_octaves);
 	emit_changed();
@@ -352,6 +645,24 @@ float FastNoiseSIMD::get_fractal_gain() const {
 	return _noise->GetFractalGain();
 }
 
+void FastNoiseSIMD::set_fractal_offset(float p_offset) {
+	_noise->SetFractalOffset(p_offset);
+	emit_changed();
+}
+
+float FastNoiseSIMD::get_fractal_offset() const {
+	return _noise->GetFractalOffset();
+}
+
+void FastNoiseSIMD::set_fractal_feedback(float p_feedback) {
+	_noise->SetFractalFeedback(p_feedback);
+	emit_changed();
+}
+
+float FastNoiseSIMD::get_fractal_feedback() const {
+	return _noise->GetFractalFeedback();
+}
+
 // Cellular
 
 void FastNoiseSIMD::set_cellular_distance_function(CellularDistanceFunction p_func) {
@@ -448,6 +759,15 @@ float FastNoiseSIMD::get_cellular_noise_lookup_frequency() const {
 	return _noise->GetCellularNoiseLookupFrequency();
 }
 
+void FastNoiseSIMD::set_cellular_noise_lookup_cache(bool p_enable) {
+	_noise->SetCellularNoiseLookupCache(p_enable);
+	emit_changed();
+}
+
+bool FastNoiseSIMD::get_cellular_noise_lookup_cache() const {
+	return _noise->GetCellularNoiseLookupCache();
+}
+
 // Generate Textures
 
 Ref<Image> FastNoiseSIMD::get_image(int p_width, int p_height, bool p_invert) {
@@ -499,6 +819,49 @@ Ref<Image> FastNoiseSIMD::get_seamless_image(int p_width, int p_height, bool p_i
 	return Noise::get_seamless_image(p_width, p_height, p_invert);
 }
 
+Ref<Image> FastNoiseSIMD::get_image_half(int p_width, int p_height, float p_scale) {
+
+	Vector<uint8_t> data;
+	data.resize(p_width * p_height * 2);
+
+	uint16_t *wd16 = (uint16_t *)data.ptrw();
+	float scale = (p_scale == 0.0) ? _scale : p_scale;
+
+	// Raw noise values, converted straight from the noise set without normalizing
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		float *ns = _noise->GetCellular2DSet(_offset.x, _offset.z, p_height, p_width, scale);
+		_noise->ConvertToHalf(wd16, ns, p_width * p_height);
+		_noise->FreeNoiseSet(ns);
+	} else {
+		_noise->FillNoiseSetHalf(wd16, _offset.x, _offset.y, _offset.z, p_height, 1, p_width, scale);
+	}
+
+	Ref<Image> image = memnew(Image(p_width, p_height, false, Image::FORMAT_RH, data));
+	return image;
+}
+
+Ref<Image> FastNoiseSIMD::get_normal_map(int p_width, int p_height, float p_strength, bool p_two_channel) {
+
+	_FastNoiseSIMD::NormalMapFormat format = p_two_channel ? _FastNoiseSIMD::RG8 : _FastNoiseSIMD::RGBA8;
+
+	Vector<uint8_t> data;
+	data.resize(p_width * p_height * (p_two_channel ? 2 : 4));
+
+	uint8_t *wd8 = data.ptrw();
+
+	// Normals straight from the noise heights, no separate image or bump map pass
+	if (_noise->GetNoiseType() == _FastNoiseSIMD::Cellular) {
+		float *ns = _noise->GetCellular2DSet(_offset.x - 1, _offset.z - 1, p_height + 2, p_width + 2, _scale);
+		_noise->FillNormalsFromHeights(wd8, ns, p_width + 2, p_height, p_width, p_strength, format);
+		_noise->FreeNoiseSet(ns);
+	} else {
+		_noise->FillNormalMap(wd8, _offset.x, _offset.y, _offset.z, p_height, p_width, p_strength, format, _scale);
+	}
+
+	Ref<Image> image = memnew(Image(p_width, p_height, false, p_two_channel ? Image::FORMAT_RG8 : Image::FORMAT_RGBA8, data));
+	return image;
+}
+
 void FastNoiseSIMD::_bind_methods() {
 
 	// General settings
@@ -535,6 +898,14 @@ void FastNoiseSIMD::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_scale"), &FastNoiseSIMD::get_scale);
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scale"), "set_scale", "get_scale");
 
+	ClassDB::bind_method(D_METHOD("set_sample_interp", "interp"), &FastNoiseSIMD::set_sample_interp);
+	ClassDB::bind_method(D_METHOD("get_sample_interp"), &FastNoiseSIMD::get_sample_interp);
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "sample_interp", PROPERTY_HINT_ENUM, "Linear,CatmullRom"), "set_sample_interp", "get_sample_interp");
+
+	ClassDB::bind_method(D_METHOD("set_precision", "precision"), &FastNoiseSIMD::set_precision);
+	ClassDB::bind_method(D_METHOD("get_precision"), &FastNoiseSIMD::get_precision);
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "precision", PROPERTY_HINT_ENUM, "Exact,Fast"), "set_precision", "get_precision");
+
 	ClassDB::bind_method(D_METHOD("get_simd_level"), &FastNoiseSIMD::get_simd_level);
 
 	// Noise functions
@@ -548,6 +919,16 @@ void FastNoiseSIMD::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_noise_set_1d", "z", "size", "scale"), &FastNoiseSIMD::_b_get_noise_set_1d, DEFVAL(0.0f));
 	ClassDB::bind_method(D_METHOD("get_noise_set_2dv", "v", "size", "scale"), &FastNoiseSIMD::_b_get_noise_set_2dv, DEFVAL(0.0f));
 	ClassDB::bind_method(D_METHOD("get_noise_set_3dv", "v", "size", "scale"), &FastNoiseSIMD::_b_get_noise_set_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_noise_chunk_3dv", "v", "size", "apron", "scale"), &FastNoiseSIMD::_b_get_noise_chunk_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_noise_set_sampled_3dv", "v", "size", "ratio", "scale"), &FastNoiseSIMD::_b_get_noise_set_sampled_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_threshold_set_3dv", "v", "size", "iso_level", "scale"), &FastNoiseSIMD::_b_get_threshold_set_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_noise_bounds_3dv", "v", "size", "scale"), &FastNoiseSIMD::get_noise_bounds_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_cell_set_3dv", "v", "size", "points", "scale"), &FastNoiseSIMD::get_cell_set_3dv, DEFVAL(false), DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_warped_set_3dv", "v", "size", "scale"), &FastNoiseSIMD::get_warped_set_3dv, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("warp_points", "points"), &FastNoiseSIMD::warp_points);
+	ClassDB::bind_method(D_METHOD("get_height_map_2dv", "v", "size", "height_scale", "height_bias", "scale"), &FastNoiseSIMD::get_height_map_2dv, DEFVAL(1.0f), DEFVAL(0.0f), DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_tile_hash_set_2dv", "v", "size"), &FastNoiseSIMD::get_tile_hash_set_2dv);
+	ClassDB::bind_method(D_METHOD("get_tile_hash_set_3dv", "v", "size"), &FastNoiseSIMD::get_tile_hash_set_3dv);
 
 	// Perturb
 
@@ -564,6 +945,18 @@ void FastNoiseSIMD::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_perturb_frequency"), &FastNoiseSIMD::get_perturb_frequency);
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "perturb_frequency"), "set_perturb_frequency", "get_perturb_frequency");
 
+	ClassDB::bind_method(D_METHOD("set_perturb_kernel", "kernel"), &FastNoiseSIMD::set_perturb_kernel);
+	ClassDB::bind_method(D_METHOD("get_perturb_kernel"), &FastNoiseSIMD::get_perturb_kernel);
+#ifdef SIMPLEX_ENABLED
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "perturb_kernel", PROPERTY_HINT_ENUM, "Lattice,Simplex"), "set_perturb_kernel", "get_perturb_kernel");
+#else
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "perturb_kernel", PROPERTY_HINT_ENUM, "Lattice"), "set_perturb_kernel", "get_perturb_kernel");
+#endif
+
+	ClassDB::bind_method(D_METHOD("set_perturb_sample_ratio", "ratio"), &FastNoiseSIMD::set_perturb_sample_ratio);
+	ClassDB::bind_method(D_METHOD("get_perturb_sample_ratio"), &FastNoiseSIMD::get_perturb_sample_ratio);
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "perturb_sample_ratio", PROPERTY_HINT_RANGE, "1,16,1"), "set_perturb_sample_ratio", "get_perturb_sample_ratio");
+
 	ClassDB::bind_method(D_METHOD("set_perturb_fractal_octaves", "octaves"), &FastNoiseSIMD::set_perturb_fractal_octaves);
 	ClassDB::bind_method(D_METHOD("get_perturb_fractal_octaves"), &FastNoiseSIMD::get_perturb_fractal_octaves);
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "perturb_fractal_octaves", PROPERTY_HINT_RANGE, "1,10,1"), "set_perturb_fractal_octaves", "get_perturb_fractal_octaves");
@@ -585,7 +978,7 @@ void FastNoiseSIMD::_bind_methods() {
 	ADD_GROUP("Fractal", "fractal_");
 	ClassDB::bind_method(D_METHOD("set_fractal_type", "type"), &FastNoiseSIMD::set_fractal_type);
 	ClassDB::bind_method(D_METHOD("get_fractal_type"), &FastNoiseSIMD::get_fractal_type);
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "fractal_type", PROPERTY_HINT_ENUM, "FBM,Billow,RidgedMulti"), "set_fractal_type", "get_fractal_type");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "fractal_type", PROPERTY_HINT_ENUM, "FBM,Billow,RidgedMulti,RidgedMultiFeedback,HybridMulti,HeteroTerrain"), "set_fractal_type", "get_fractal_type");
 
 	ClassDB::bind_method(D_METHOD("set_fractal_octaves", "octaves"), &FastNoiseSIMD::set_fractal_octaves);
 	ClassDB::bind_method(D_METHOD("get_fractal_octaves"), &FastNoiseSIMD::get_fractal_octaves);
@@ -599,6 +992,14 @@ void FastNoiseSIMD::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_fractal_gain"), &FastNoiseSIMD::get_fractal_gain);
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fractal_gain"), "set_fractal_gain", "get_fractal_gain");
 
+	ClassDB::bind_method(D_METHOD("set_fractal_offset", "offset"), &FastNoiseSIMD::set_fractal_offset);
+	ClassDB::bind_method(D_METHOD("get_fractal_offset"), &FastNoiseSIMD::get_fractal_offset);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fractal_offset"), "set_fractal_offset", "get_fractal_offset");
+
+	ClassDB::bind_method(D_METHOD("set_fractal_feedback", "feedback"), &FastNoiseSIMD::set_fractal_feedback);
+	ClassDB::bind_method(D_METHOD("get_fractal_feedback"), &FastNoiseSIMD::get_fractal_feedback);
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fractal_feedback"), "set_fractal_feedback", "get_fractal_feedback");
+
 	// Cellular
 
 	ADD_GROUP("Cellular", "cellular_");
@@ -639,9 +1040,15 @@ void FastNoiseSIMD::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_cellular_noise_lookup_frequency"), &FastNoiseSIMD::get_cellular_noise_lookup_frequency);
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cellular_noise_lookup_frequency"), "set_cellular_noise_lookup_frequency", "get_cellular_noise_lookup_frequency");
 
+	ClassDB::bind_method(D_METHOD("set_cellular_noise_lookup_cache", "enable"), &FastNoiseSIMD::set_cellular_noise_lookup_cache);
+	ClassDB::bind_method(D_METHOD("get_cellular_noise_lookup_cache"), &FastNoiseSIMD::get_cellular_noise_lookup_cache);
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "cellular_noise_lookup_cache"), "set_cellular_noise_lookup_cache", "get_cellular_noise_lookup_cache");
+
 	// Textures
 	ClassDB::bind_method(D_METHOD("get_image", "width", "height", "invert"), &FastNoiseSIMD::get_image, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_seamless_image", "width", "height", "invert"), &FastNoiseSIMD::get_seamless_image, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_image_half", "width", "height", "scale"), &FastNoiseSIMD::get_image_half, DEFVAL(0.0f));
+	ClassDB::bind_method(D_METHOD("get_normal_map", "width", "height", "strength", "two_channel"), &FastNoiseSIMD::get_normal_map, DEFVAL(1.0f), DEFVAL(false));
 
 	BIND_ENUM_CONSTANT(TYPE_VALUE);
 	BIND_ENUM_CONSTANT(TYPE_VALUE_FRACTAL);
@@ -659,6 +1066,9 @@ void FastNoiseSIMD::_bind_methods() {
 	BIND_ENUM_CONSTANT(FRACTAL_FBM);
 	BIND_ENUM_CONSTANT(FRACTAL_BILLOW);
 	BIND_ENUM_CONSTANT(FRACTAL_RIDGED_MULTI);
+	BIND_ENUM_CONSTANT(FRACTAL_RIDGED_MULTI_FEEDBACK);
+	BIND_ENUM_CONSTANT(FRACTAL_HYBRID_MULTI);
+	BIND_ENUM_CONSTANT(FRACTAL_HETERO_TERRAIN);
 
 	BIND_ENUM_CONSTANT(PERTURB_NONE);
 	BIND_ENUM_CONSTANT(PERTURB_GRADIENT);
@@ -667,6 +1077,11 @@ void FastNoiseSIMD::_bind_methods() {
 	BIND_ENUM_CONSTANT(PERTURB_GRADIENT_NORMALIZE);
 	BIND_ENUM_CONSTANT(PERTURB_GRADIENT_FRACTAL_NORMALIZE);
 
+	BIND_ENUM_CONSTANT(PERTURB_KERNEL_LATTICE);
+#ifdef SIMPLEX_ENABLED
+	BIND_ENUM_CONSTANT(PERTURB_KERNEL_SIMPLEX);
+#endif
+
 	BIND_ENUM_CONSTANT(DISTANCE_EUCLIDEAN);
 	BIND_ENUM_CONSTANT(DISTANCE_MANHATTAN);
 	BIND_ENUM_CONSTANT(DISTANCE_NATURAL);
@@ -680,6 +1095,12 @@ void FastNoiseSIMD::_bind_methods() {
 	BIND_ENUM_CONSTANT(RETURN_DISTANCE2_DIV);
 	BIND_ENUM_CONSTANT(RETURN_DISTANCE2_CAVE);
 	BIND_ENUM_CONSTANT(RETURN_NOISE_LOOKUP);
+
+	BIND_ENUM_CONSTANT(SAMPLE_LINEAR);
+	BIND_ENUM_CONSTANT(SAMPLE_CATMULL_ROM);
+
+	BIND_ENUM_CONSTANT(PRECISION_EXACT);
+	BIND_ENUM_CONSTANT(PRECISION_FAST);
 }
 
 void FastNoiseSIMD::_validate_property(PropertyInfo& property) const {
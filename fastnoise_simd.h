@@ -56,7 +56,10 @@ public:
 	enum FractalType {
 		FRACTAL_FBM = _FastNoiseSIMD::FBM,
 		FRACTAL_BILLOW = _FastNoiseSIMD::Billow,
-		FRACTAL_RIDGED_MULTI = _FastNoiseSIMD::RigidMulti
+		FRACTAL_RIDGED_MULTI = _FastNoiseSIMD::RigidMulti,
+		FRACTAL_RIDGED_MULTI_FEEDBACK = _FastNoiseSIMD::RigidMultiFeedback,
+		FRACTAL_HYBRID_MULTI = _FastNoiseSIMD::HybridMulti,
+		FRACTAL_HETERO_TERRAIN = _FastNoiseSIMD::HeteroTerrain
 	};
 
 	enum PerturbType {
@@ -68,6 +71,13 @@ public:
 		PERTURB_GRADIENT_FRACTAL_NORMALIZE = _FastNoiseSIMD::GradientFractal_Normalise
 	};
 
+	enum PerturbKernel {
+		PERTURB_KERNEL_LATTICE = _FastNoiseSIMD::LatticeGradient,
+#ifdef SIMPLEX_ENABLED
+		PERTURB_KERNEL_SIMPLEX = _FastNoiseSIMD::SimplexGradient
+#endif
+	};
+
 	enum CellularDistanceFunction {
 		DISTANCE_EUCLIDEAN = _FastNoiseSIMD::Euclidean,
 		DISTANCE_MANHATTAN = _FastNoiseSIMD::Manhattan,
@@ -87,6 +97,16 @@ public:
 
 	};
 
+	enum SampleInterp {
+		SAMPLE_LINEAR = _FastNoiseSIMD::Linear,
+		SAMPLE_CATMULL_ROM = _FastNoiseSIMD::CatmullRom
+	};
+
+	enum Precision {
+		PRECISION_EXACT = _FastNoiseSIMD::Exact,
+		PRECISION_FAST = _FastNoiseSIMD::Fast
+	};
+
 	FastNoiseSIMD();
 	~FastNoiseSIMD();
 
@@ -110,6 +130,12 @@ public:
 	void set_scale(float p_scale);
 	float get_scale() const;
 
+	void set_sample_interp(SampleInterp p_interp);
+	SampleInterp get_sample_interp() const;
+
+	void set_precision(Precision p_precision);
+	Precision get_precision() const;
+
 	int get_simd_level() const;
 
 	// Noise singular value functions (These are very slow. 1/3rd the speed of FastNoise.)
@@ -133,11 +159,48 @@ public:
 	void fill_noise_set_3d(float *p_set, int p_x, int p_y, int p_z, int p_sizex, int p_sizey, int p_sizez, float p_scale = 0.0f);
 	void free_noise_set(float *set);
 
+	// Chunk set functions (Sets are padded with an apron on every side. Chunks generated in +X order reuse their shared border.)
+
+	float *get_noise_chunk_3dv(Vector3 p_v, Vector3 p_size, int p_apron, float p_scale = 0.0f);
+
+	// Threshold set functions (1.0 where the noise is above the iso level, 0.0 elsewhere. Fractals skip octaves that can't change the result.)
+
+	float *get_threshold_set_3dv(Vector3 p_v, Vector3 p_size, float p_iso_level, float p_scale = 0.0f);
+
+	// Sampled set functions (Noise is generated every ratio values per axis and interpolated in between)
+
+	float *get_noise_set_sampled_3dv(Vector3 p_v, Vector3 p_size, Vector3 p_ratio, float p_scale = 0.0f);
+
+	// Cellular cell sets (Closest cell ID per value, optionally with the closest and second closest cell points)
+
+	Array get_cell_set_3dv(Vector3 p_v, Vector3 p_size, bool p_points = false, float p_scale = 0.0f);
+
+	// Warped sets (The coordinates noise is sampled at after perturb, computed once for several layers or mesh positions)
+
+	Vector<Vector3> get_warped_set_3dv(Vector3 p_v, Vector3 p_size, float p_scale = 0.0f);
+	Vector<Vector3> warp_points(const Vector<Vector3> &p_points);
+
+	// Height maps (Scaled heights in the row layout of HeightMapShape3D map_data, with their min and max for the shape's AABB)
+
+	Array get_height_map_2dv(Vector2 p_v, Vector2 p_size, float p_height_scale = 1.0f, float p_height_bias = 0.0f, float p_scale = 0.0f);
+
+	// Tile hash sets (Integer hash per lattice point, the hashes white noise is made from)
+
+	Vector<int32_t> get_tile_hash_set_2dv(Vector2 p_v, Vector2 p_size);
+	Vector<int32_t> get_tile_hash_set_3dv(Vector3 p_v, Vector3 p_size);
+
+	// Guaranteed min (x) and max (y) of the noise set for the same parameters, without filling it
+
+	Vector2 get_noise_bounds_3dv(Vector3 p_v, Vector3 p_size, float p_scale = 0.0f);
+
 	// Allocate PoolVectors for GDScript
 
 	Vector<float> _b_get_noise_set_1d(float p_z, int p_sizez, float p_scale = 0.0f);
 	Vector<float> _b_get_noise_set_2dv(Vector2 p_v, Vector2 p_size, float p_scale = 0.0f);
 	Vector<float> _b_get_noise_set_3dv(Vector3 p_v, Vector3 p_size, float p_scale = 0.0f);
+	Vector<float> _b_get_noise_chunk_3dv(Vector3 p_v, Vector3 p_size, int p_apron, float p_scale = 0.0f);
+	Vector<float> _b_get_noise_set_sampled_3dv(Vector3 p_v, Vector3 p_size, Vector3 p_ratio, float p_scale = 0.0f);
+	Vector<uint8_t> _b_get_threshold_set_3dv(Vector3 p_v, Vector3 p_size, float p_iso_level, float p_scale = 0.0f);
 
 	// Perturb texture coordinates within the noise functions
 
@@ -150,6 +213,12 @@ public:
 	void set_perturb_frequency(float p_freq);
 	float get_perturb_frequency() const;
 
+	void set_perturb_kernel(PerturbKernel p_kernel);
+	PerturbKernel get_perturb_kernel() const;
+
+	void set_perturb_sample_ratio(int p_ratio);
+	int get_perturb_sample_ratio() const;
+
 	void set_perturb_fractal_octaves(int p_octaves);
 	int get_perturb_fractal_octaves();
 
@@ -176,6 +245,12 @@ public:
 	void set_fractal_gain(float p_gain);
 	float get_fractal_gain() const;
 
+	void set_fractal_offset(float p_offset);
+	float get_fractal_offset() const;
+
+	void set_fractal_feedback(float p_feedback);
+	float get_fractal_feedback() const;
+
 	// Cellular specific
 
 	void set_cellular_distance_function(CellularDistanceFunction p_func);
@@ -201,18 +276,28 @@ public:
 	void set_cellular_noise_lookup_frequency(float p_freq);
 	float get_cellular_noise_lookup_frequency() const;
 
+	void set_cellular_noise_lookup_cache(bool p_enable);
+	bool get_cellular_noise_lookup_cache() const;
+
 	// Generate Textures
 
 	Ref<Image> get_image(int p_width, int p_height, bool p_invert = false);
 	Ref<Image> get_seamless_image(int p_width, int p_height, bool p_invert = false);
+	Ref<Image> get_image_half(int p_width, int p_height, float p_scale = 0.0f);
+	Ref<Image> get_normal_map(int p_width, int p_height, float p_strength = 1.0f, bool p_two_channel = false);
 
 protected:
 	static void _bind_methods();
 	virtual void _validate_property(PropertyInfo& property) const;
 
 private:
+	float *_get_sample_scratch(Vector3 p_v, Vector3 p_size, Vector3 p_ratio);
+
 	_FastNoiseSIMD *_noise;
 	List<float *> _allocated_sets;
+	FastNoiseChunkCache _chunk_cache;
+	float *_sample_scratch = nullptr;
+	int _sample_scratch_size = 0;
 	Vector3 _offset;
 	float _scale;
 
@@ -226,7 +311,10 @@ private:
 VARIANT_ENUM_CAST(FastNoiseSIMD::NoiseType);
 VARIANT_ENUM_CAST(FastNoiseSIMD::FractalType);
 VARIANT_ENUM_CAST(FastNoiseSIMD::PerturbType);
+VARIANT_ENUM_CAST(FastNoiseSIMD::PerturbKernel);
 VARIANT_ENUM_CAST(FastNoiseSIMD::CellularDistanceFunction);
 VARIANT_ENUM_CAST(FastNoiseSIMD::CellularReturnType);
+VARIANT_ENUM_CAST(FastNoiseSIMD::SampleInterp);
+VARIANT_ENUM_CAST(FastNoiseSIMD::Precision);
 
 #endif // FASTNOISE_SIMD_H
@@ -0,0 +1,229 @@
+/*************************************************************************/
+/*  test_fastnoise_simd.h                                                */
+/*************************************************************************/
+/* Copyright (c) 2020 Cory Petkovsek                                     */
+/*                                                                       */
+/* Permission is hereby granted, free of charge, to any person obtaining */
+/* a copy of this software and associated documentation files (the       */
+/* "Software"), to deal in the Software without restriction, including   */
+/* without limitation the rights to use, copy, modify, merge, publish,   */
+/* distribute, sublicense, and/or sell copies of the Software, and to    */
+/* permit persons to whom the Software is furnished to do so, subject to */
+/* the following conditions:                                             */
+/*                                                                       */
+/* The above copyright notice and this permission notice shall be        */
+/* included in all copies or substantial portions of the Software.       */
+/*                                                                       */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,       */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF    */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.*/
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY  */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,  */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE     */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                */
+/*************************************************************************/
+
+#ifndef TEST_FASTNOISE_SIMD_H
+#define TEST_FASTNOISE_SIMD_H
+
+#include "../thirdparty/FastNoiseSIMD.h"
+
+#include "tests/test_macros.h"
+
+#include <cstring>
+
+namespace TestFastNoiseSIMD {
+
+// Cell IDs must come from the same search as CellValue, which is the ID / 2^31
+TEST_CASE("[FastNoiseSIMD] Cell IDs match CellValue at large offsets") {
+	const int size = 32;
+	const int count = size * size * size;
+
+	for (int level = 0; level <= FN_AVX512_SKX; level++) {
+		_FastNoiseSIMD *noise = _FastNoiseSIMD::NewFastNoiseSIMD(1337, level);
+		if (noise->GetInstanceSIMDLevel() != level) {
+			delete noise;
+			continue;
+		}
+
+		noise->SetNoiseType(_FastNoiseSIMD::Cellular);
+		noise->SetCellularReturnType(_FastNoiseSIMD::CellValue);
+
+		for (int func = _FastNoiseSIMD::Euclidean; func <= _FastNoiseSIMD::Natural; func++) {
+			noise->SetCellularDistanceFunction((_FastNoiseSIMD::CellularDistanceFunction)func);
+
+			const int offsets[] = { 5000, 200000 };
+			for (int offset : offsets) {
+				noise->SetFrequency(offset == 5000 ? 0.3f : 1.0f);
+
+				float *values = noise->GetNoiseSet(offset, offset, offset, size, size, size);
+				int *cells = _FastNoiseSIMD::GetEmptyIntSet(count);
+				noise->FillCellularCellSet(cells, nullptr, nullptr, offset, offset, offset, size, size, size);
+
+				int mismatches = 0;
+				for (int i = 0; i < count; i++) {
+					if (values[i] != float(cells[i]) * (1.0f / 2147483648.0f)) {
+						mismatches++;
+					}
+				}
+
+				INFO("SIMD level ", level, ", distance function ", func, ", offset ", offset);
+				CHECK(mismatches == 0);
+
+				_FastNoiseSIMD::FreeNoiseSet(values);
+				_FastNoiseSIMD::FreeIntSet(cells);
+			}
+		}
+
+		delete noise;
+	}
+}
+
+// Sampled sets generate noise on the grid points, so those match a full set with any scale modifier
+TEST_CASE("[FastNoiseSIMD] Sampled set grid points match the noise set") {
+	const int size = 24;
+	const int ratio = 4;
+	const int start = -37;
+	const float scales[] = { 1.0f, 0.37f, 2.5f };
+
+	_FastNoiseSIMD *noise = _FastNoiseSIMD::NewFastNoiseSIMD(1337);
+	noise->SetNoiseType(_FastNoiseSIMD::PerlinFractal);
+	noise->SetFrequency(0.07f);
+
+	for (int interp = _FastNoiseSIMD::Linear; interp <= _FastNoiseSIMD::CatmullRom; interp++) {
+		noise->SetSampleInterp((_FastNoiseSIMD::SampleInterp)interp);
+
+		for (float scale : scales) {
+			float *values = noise->GetNoiseSet(start, start, start, size, size, size, scale);
+			float *sampled = noise->GetSampledNoiseSet(start, start, start, size, size, size, ratio, ratio, ratio, scale);
+
+			int mismatches = 0;
+			for (int x = 0; x < size; x++) {
+				for (int y = 0; y < size; y++) {
+					for (int z = 0; z < size; z++) {
+						if ((start + x) % ratio || (start + y) % ratio || (start + z) % ratio) {
+							continue;
+						}
+
+						int i = (x * size + y) * size + z;
+						if (values[i] != sampled[i]) {
+							mismatches++;
+						}
+					}
+				}
+			}
+
+			INFO("Interpolation ", interp, ", scale modifier ", scale);
+			CHECK(mismatches == 0);
+
+			_FastNoiseSIMD::FreeNoiseSet(values);
+			_FastNoiseSIMD::FreeNoiseSet(sampled);
+		}
+	}
+
+	delete noise;
+}
+
+// GetNoiseBounds promises every value of the same set is inside the bounds
+TEST_CASE("[FastNoiseSIMD] Noise bounds contain the noise set") {
+	const _FastNoiseSIMD::NoiseType noiseTypes[] = {
+		_FastNoiseSIMD::Value, _FastNoiseSIMD::ValueFractal, _FastNoiseSIMD::Perlin, _FastNoiseSIMD::PerlinFractal,
+#ifdef SIMPLEX_ENABLED
+		_FastNoiseSIMD::Simplex, _FastNoiseSIMD::SimplexFractal,
+#endif
+		_FastNoiseSIMD::Cubic, _FastNoiseSIMD::CubicFractal, _FastNoiseSIMD::WhiteNoise
+	};
+
+	_FastNoiseSIMD *noise = _FastNoiseSIMD::NewFastNoiseSIMD(1337);
+	unsigned int state = 1;
+
+	for (_FastNoiseSIMD::NoiseType noiseType : noiseTypes) {
+		for (int fractalType = _FastNoiseSIMD::FBM; fractalType <= _FastNoiseSIMD::HeteroTerrain; fractalType++) {
+			for (int precision = _FastNoiseSIMD::Exact; precision <= _FastNoiseSIMD::Fast; precision++) {
+				noise->SetNoiseType(noiseType);
+				noise->SetFractalType((_FastNoiseSIMD::FractalType)fractalType);
+				noise->SetPrecision((_FastNoiseSIMD::Precision)precision);
+
+				int violations = 0;
+				for (int i = 0; i < 40; i++) {
+					// Small LCG so every run checks the same regions
+					state = state * 1664525u + 1013904223u;
+					noise->SetSeed(int(state >> 8));
+					noise->SetFractalOctaves(1 + (state >> 4) % 4);
+					noise->SetFrequency(0.005f + ((state >> 12) % 1000) * 0.0003f);
+
+					// Bounds of tiny regions are the tightest, so half of the regions are at most 2 wide
+					int maxSize = i % 2 ? 16 : 2;
+					int xSize = 1 + (state >> 22) % maxSize;
+					int ySize = 1 + (state >> 18) % maxSize;
+					int zSize = 1 + (state >> 26) % maxSize;
+					int start = int((state >> 10) % 2000) - 1000;
+
+					float min, max;
+					CHECK(noise->GetNoiseBounds(start, -start, start / 2, xSize, ySize, zSize, min, max));
+
+					float *values = noise->GetNoiseSet(start, -start, start / 2, xSize, ySize, zSize);
+					for (int j = 0; j < xSize * ySize * zSize; j++) {
+						if (values[j] < min || values[j] > max) {
+							violations++;
+							break;
+						}
+					}
+					_FastNoiseSIMD::FreeNoiseSet(values);
+				}
+
+				INFO("Noise type ", noiseType, ", fractal type ", fractalType, ", precision ", precision);
+				CHECK(violations == 0);
+			}
+		}
+	}
+
+	delete noise;
+}
+
+#ifdef FN_DETERMINISTIC
+// Every level must give the same bits, including the sign of zeros and the origin of normalised perturbs
+TEST_CASE("[FastNoiseSIMD] Deterministic builds match bitwise on every level") {
+	const int size = 16;
+	const int count = size * size * size;
+	const int perturbTypes[] = { _FastNoiseSIMD::None, _FastNoiseSIMD::Normalise, _FastNoiseSIMD::GradientFractal_Normalise };
+
+	_FastNoiseSIMD *reference = _FastNoiseSIMD::NewFastNoiseSIMD(1337, 0);
+
+	for (int level = 1; level <= FN_AVX512_SKX; level++) {
+		_FastNoiseSIMD *noise = _FastNoiseSIMD::NewFastNoiseSIMD(1337, level);
+		if (noise->GetInstanceSIMDLevel() != level) {
+			delete noise;
+			continue;
+		}
+
+		for (int type = _FastNoiseSIMD::Value; type <= _FastNoiseSIMD::CubicFractal; type++) {
+			for (int perturb : perturbTypes) {
+				_FastNoiseSIMD *both[] = { reference, noise };
+				for (_FastNoiseSIMD *n : both) {
+					n->SetNoiseType((_FastNoiseSIMD::NoiseType)type);
+					n->SetPerturbType((_FastNoiseSIMD::PerturbType)perturb);
+					n->SetFrequency(1.0f);
+				}
+
+				float *expected = reference->GetNoiseSet(-size / 2, -size / 2, -size / 2, size, size, size);
+				float *values = noise->GetNoiseSet(-size / 2, -size / 2, -size / 2, size, size, size);
+
+				INFO("SIMD level ", level, ", noise type ", type, ", perturb type ", perturb);
+				CHECK(memcmp(expected, values, count * sizeof(float)) == 0);
+
+				_FastNoiseSIMD::FreeNoiseSet(expected);
+				_FastNoiseSIMD::FreeNoiseSet(values);
+			}
+		}
+
+		delete noise;
+	}
+
+	delete reference;
+}
+#endif
+
+} // namespace TestFastNoiseSIMD
+
+#endif // TEST_FASTNOISE_SIMD_H
@@ -30,7 +30,10 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <chrono>
 
 #ifdef FN_COMPILE_NO_SIMD_FALLBACK
 #define SIMD_LEVEL_H FN_NO_SIMD_FALLBACK
@@ -57,26 +60,55 @@
 #include "FastNoiseSIMD_internal.h"
 #endif
 
+#ifdef FN_COMPILE_AVX512_SKX
+#define SIMD_LEVEL_H FN_AVX512_SKX
+#include "FastNoiseSIMD_internal.h"
+#endif
+
 #ifdef FN_COMPILE_NEON
 #define SIMD_LEVEL_H FN_NEON
 #include "FastNoiseSIMD_internal.h"
 #endif
 
+#ifdef FN_COMPILE_PORTABLE
+#define SIMD_LEVEL_H FN_PORTABLE
+#include "FastNoiseSIMD_internal.h"
+#endif
+
+// The portable level is picked automatically only when there is no native level to pick,
+// otherwise it has to be selected with SetSIMDLevel(FN_PORTABLE)
+#if defined(FN_COMPILE_PORTABLE) && !defined(FN_COMPILE_SSE2) && !defined(FN_COMPILE_NEON)
+#define FN_PORTABLE_ONLY
+#endif
+
 // CPUid
 #ifdef _WIN32
 #include <intrin.h>
+#include <malloc.h>
 #elif defined(FN_ARM)
 #if !defined(__aarch64__) && !defined(FN_IOS)
 #include "ARM/cpu-features.h"
 #endif
-#else
+#elif defined(FN_X86)
 #include <cpuid.h>
 #include "inttypes.h"
 #endif
 
-int _FastNoiseSIMD::s_currentSIMDLevel = -1;
+std::atomic<int> _FastNoiseSIMD::s_currentSIMDLevel(-1);
+std::atomic<_FastNoiseSIMD::SIMDPolicy> _FastNoiseSIMD::s_SIMDPolicy(_FastNoiseSIMD::Fastest);
+static thread_local int t_threadSIMDLevel = -1;
 
-#ifdef FN_ARM
+#if defined(FN_PORTABLE_ONLY) || !(defined(FN_ARM) || defined(FN_X86))
+// Nothing to detect, the portable level runs on any CPU the build targets
+int GetFastestSIMD()
+{
+#ifdef FN_COMPILE_PORTABLE
+	return FN_PORTABLE;
+#else
+	return FN_NO_SIMD_FALLBACK;
+#endif
+}
+#elif defined(FN_ARM)
 int GetFastestSIMD()
 {
 #if defined(__aarch64__) || defined(FN_IOS)
@@ -177,96 +209,227 @@ int GetFastestSIMD()
 	if (!cpuAVX512Support || !oxAVX512Support)
 		return FN_AVX2;
 
-	return FN_AVX512;	
+	// AVX512 VL DQ BW
+	bool cpuAVX512DQSupport = (cpuInfo[1] & 1 << 17) != 0;
+	bool cpuAVX512BWSupport = (cpuInfo[1] & 1 << 30) != 0;
+	bool cpuAVX512VLSupport = (cpuInfo[1] & 1 << 31) != 0;
+
+	if (!cpuAVX512DQSupport || !cpuAVX512BWSupport || !cpuAVX512VLSupport)
+		return FN_AVX512;
+
+	return FN_AVX512_SKX;
 }
 #endif
 
-_FastNoiseSIMD* _FastNoiseSIMD::NewFastNoiseSIMD(int seed)
+// Every compiled level, resolved once on first use
+// Sets are laid out for the widest compiled level so they can be shared between instances of any level
+struct SIMDLevelTable
 {
-	GetSIMDLevel();
+	_FastNoiseSIMD* (*newNoise[FN_AVX512_SKX + 1])(int seed);
+	int resolvedLevel[FN_AVX512_SKX + 1];
+	int setVectorSize;
 
-#ifdef FN_COMPILE_NEON
+	SIMDLevelTable() : newNoise(), setVectorSize(1)
+	{
 #ifdef FN_COMPILE_NO_SIMD_FALLBACK
-	if (s_currentSIMDLevel >= FN_NEON)
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NO_SIMD_FALLBACK)>(FN_NO_SIMD_FALLBACK);
 #endif
-		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)(seed);
+#ifdef FN_COMPILE_SSE2
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)>(FN_SSE2);
 #endif
-
-#ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
-		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)(seed);
+#ifdef FN_COMPILE_SSE41
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE41)>(FN_SSE41);
 #endif
-
 #ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
-		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)(seed);
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)>(FN_AVX2);
 #endif
-
-#ifdef FN_COMPILE_SSE41
-	if (s_currentSIMDLevel >= FN_SSE41)
-		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE41)(seed);
+#ifdef FN_COMPILE_AVX512
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)>(FN_AVX512);
 #endif
-
-#ifdef FN_COMPILE_SSE2
-#ifdef FN_COMPILE_NO_SIMD_FALLBACK
-	if (s_currentSIMDLevel >= FN_SSE2)
+#ifdef FN_COMPILE_AVX512_SKX
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512_SKX)>(FN_AVX512_SKX);
 #endif
-		return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)(seed);
+#ifdef FN_COMPILE_NEON
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)>(FN_NEON);
 #endif
-
-#ifdef FN_COMPILE_NO_SIMD_FALLBACK
-	return new FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NO_SIMD_FALLBACK)(seed);
+#ifdef FN_COMPILE_PORTABLE
+		Add<FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_PORTABLE)>(FN_PORTABLE);
 #endif
+
+		for (int level = 0; level <= FN_AVX512_SKX; level++)
+			resolvedLevel[level] = Resolve(level);
+	}
+
+	template<class T>
+	void Add(int level)
+	{
+		newNoise[level] = [](int seed) -> _FastNoiseSIMD* { return new T(seed); };
+		setVectorSize = std::max(setVectorSize, T::VectorSize());
+	}
+
+	// Portable is only used when asked for or when it is the only SIMD level, the native levels step down
+	// to the next compiled level below, and the lowest compiled level is used when there is no fallback
+	// AVX512 SKX steps down to AVX512
+	int Resolve(int level) const
+	{
+		if (level == FN_AVX512_SKX)
+		{
+			if (newNoise[FN_AVX512_SKX])
+				return FN_AVX512_SKX;
+
+			level = FN_AVX512;
+		}
+
+		if (level == FN_PORTABLE && newNoise[FN_PORTABLE])
+			return FN_PORTABLE;
+
+		for (int i = std::min(level, (int)FN_NEON); i > FN_NO_SIMD_FALLBACK; i--)
+		{
+			if (newNoise[i])
+				return i;
+		}
+
+		if (level > FN_NO_SIMD_FALLBACK && newNoise[FN_PORTABLE])
+			return FN_PORTABLE;
+
+		for (int i = FN_NO_SIMD_FALLBACK; i <= FN_AVX512_SKX; i++)
+		{
+			if (newNoise[i])
+				return i;
+		}
+		return FN_NO_SIMD_FALLBACK;
+	}
+};
+
+static const SIMDLevelTable& GetSIMDLevelTable()
+{
+	static const SIMDLevelTable table;
+	return table;
+}
+
+// Times the same small fractal fill on every compiled level the CPU supports and returns the quickest
+// The fallback is only timed when there is nothing else, it is never faster than a SIMD level
+static int CalibrateSIMD(int fastest)
+{
+	const SIMDLevelTable& table = GetSIMDLevelTable();
+	const int size = 16;
+
+	float* noiseSet = _FastNoiseSIMD::GetEmptySet(size, size, size);
+	int bestLevel = table.resolvedLevel[fastest];
+	double bestTime = 0.0;
+
+	for (int level = FN_NO_SIMD_FALLBACK + 1; level <= FN_AVX512_SKX; level++)
+	{
+		if (!table.newNoise[level] || (level > fastest && level != FN_PORTABLE))
+			continue;
+
+		_FastNoiseSIMD* noise = table.newNoise[level](1337);
+		noise->SetNoiseType(_FastNoiseSIMD::PerlinFractal);
+
+		// First fill is a warm up, the best of the rest is kept so one interruption doesn't skew the choice
+		double levelTime = 0.0;
+		for (int run = 0; run < 4; run++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			noise->FillNoiseSet(noiseSet, 0, run * size, 0, size, size, size);
+			double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			if (run == 1 || (run > 1 && time < levelTime))
+				levelTime = time;
+		}
+		delete noise;
+
+		if (bestTime == 0.0 || levelTime < bestTime)
+		{
+			bestTime = levelTime;
+			bestLevel = level;
+		}
+	}
+
+	_FastNoiseSIMD::FreeNoiseSet(noiseSet);
+	return bestLevel;
+}
+
+static int SelectSIMDLevel(_FastNoiseSIMD::SIMDPolicy policy)
+{
+	int fastest = GetFastestSIMD();
+
+	switch (policy)
+	{
+	case _FastNoiseSIMD::PreferAVX2:
+		return fastest == FN_AVX512 || fastest == FN_AVX512_SKX ? FN_AVX2 : fastest;
+	case _FastNoiseSIMD::Calibrate:
+		return CalibrateSIMD(fastest);
+	default:
+		return fastest;
+	}
+}
+
+_FastNoiseSIMD* _FastNoiseSIMD::NewFastNoiseSIMD(int seed)
+{
+	return NewFastNoiseSIMD(seed, t_threadSIMDLevel >= 0 ? t_threadSIMDLevel : GetSIMDLevel());
+}
+
+_FastNoiseSIMD* _FastNoiseSIMD::NewFastNoiseSIMD(int seed, int level)
+{
+	if (level < 0)
+		level = GetSIMDLevel();
+
+	const SIMDLevelTable& table = GetSIMDLevelTable();
+
+	return table.newNoise[table.resolvedLevel[std::min(level, (int)FN_AVX512_SKX)]](seed);
 }
 
 int _FastNoiseSIMD::GetSIMDLevel()
 {
-	if (s_currentSIMDLevel < 0)
-		s_currentSIMDLevel = GetFastestSIMD();
+	int level = s_currentSIMDLevel;
 
-	return s_currentSIMDLevel;
+	// Threads that get here together may each select a level, the first one stored is used by all of them
+	if (level < 0)
+	{
+		int selected = SelectSIMDLevel(s_SIMDPolicy);
+
+		if (s_currentSIMDLevel.compare_exchange_strong(level, selected))
+			level = selected;
+	}
+
+	return level;
+}
+
+void _FastNoiseSIMD::SetThreadSIMDLevel(int level)
+{
+	t_threadSIMDLevel = level;
+}
+
+int _FastNoiseSIMD::GetThreadSIMDLevel()
+{
+	return t_threadSIMDLevel;
 }
 
 void _FastNoiseSIMD::FreeNoiseSet(float* floatArray)
 {
 #ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-	if (s_currentSIMDLevel > FN_NO_SIMD_FALLBACK)
 #ifdef _WIN32
-		_aligned_free(floatArray);
+	_aligned_free(floatArray);
 #else
-		free(floatArray);
+	free(floatArray);
 #endif
-	else
+#else
+	delete[] floatArray;
 #endif
-		delete[] floatArray;
 }
 
 int _FastNoiseSIMD::AlignedSize(int size)
 {
 #ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-#ifdef FN_COMPILE_NEON
-	if (s_currentSIMDLevel >= FN_NEON)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)::AlignedSize(size);
-#endif
+	int vectorSize = GetSIMDLevelTable().setVectorSize;
 
-#ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)::AlignedSize(size);
-#endif
-
-#ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)::AlignedSize(size);
-#endif
-
-#ifdef FN_COMPILE_SSE2
-	if (s_currentSIMDLevel >= FN_SSE2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)::AlignedSize(size);
-#endif
+	// size must be a multiple of the widest vector size
+	if ((size & (vectorSize - 1)) != 0)
+	{
+		size &= ~(vectorSize - 1);
+		size += vectorSize;
+	}
 #endif
 	return size;
 }
@@ -274,29 +437,20 @@ int _FastNoiseSIMD::AlignedSize(int size)
 float* _FastNoiseSIMD::GetEmptySet(int size)
 {
 #ifdef FN_ALIGNED_SETS
-	GetSIMDLevel();
-
-#ifdef FN_COMPILE_NEON
-	if (s_currentSIMDLevel >= FN_NEON)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_NEON)::GetEmptySet(size);
-#endif
+	size = AlignedSize(size);
 
-#ifdef FN_COMPILE_AVX512
-	if (s_currentSIMDLevel >= FN_AVX512)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX512)::GetEmptySet(size);
-#endif
-
-#ifdef FN_COMPILE_AVX2
-	if (s_currentSIMDLevel >= FN_AVX2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_AVX2)::GetEmptySet(size);
-#endif
-
-#ifdef FN_COMPILE_SSE2
-	if (s_currentSIMDLevel >= FN_SSE2)
-		return FastNoiseSIMD_internal::FASTNOISE_SIMD_CLASS(FN_SSE2)::GetEmptySet(size);
-#endif
+	size_t alignment = std::max(GetSIMDLevelTable().setVectorSize * sizeof(float), sizeof(void*));
+	float* noiseSet;
+#ifdef _WIN32
+	noiseSet = (float*)_aligned_malloc(size * sizeof(float), alignment);
+#else
+	if (posix_memalign((void**)&noiseSet, alignment, size * sizeof(float)) != 0)
+		noiseSet = nullptr;
 #endif
+	return noiseSet;
+#else
 	return new float[size];
+#endif
 }
 
 FastNoiseVectorSet* _FastNoiseSIMD::GetVectorSet(int xSize, int ySize, int zSize)
@@ -312,6 +466,8 @@ void _FastNoiseSIMD::FillVectorSet(FastNoiseVectorSet* vectorSet, int xSize, int
 
 	vectorSet->SetSize(xSize*ySize*zSize);
 	vectorSet->sampleScale = 0;
+	vectorSet->warped = false;
+	vectorSet->scaleModifier = 1.0f;
 
 	int index = 0;
 
@@ -373,6 +529,8 @@ void _FastNoiseSIMD::FillSamplingVectorSet(FastNoiseVectorSet* vectorSet, int sa
 
 	vectorSet->SetSize(xSizeSample*ySizeSample*zSizeSample);
 	vectorSet->sampleScale = sampleScale;
+	vectorSet->warped = false;
+	vectorSet->scaleModifier = 1.0f;
 
 	int index = 0;
 
@@ -402,6 +560,16 @@ float* _FastNoiseSIMD::GetNoiseSet(int xStart, int yStart, int zStart, int xSize
 
 void _FastNoiseSIMD::FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
 {
+	// Perturb sampled on a coarse grid, the noise is filled from the interpolated coordinates
+	// White noise sets are on the integer lattice and never perturbed
+	if (m_perturbSampleRatio > 1 && m_perturbType != None && m_noiseType != WhiteNoise)
+	{
+		FastNoiseVectorSet warpedSet;
+		FillWarpedVectorSet(&warpedSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+		FillNoiseSet(noiseSet, &warpedSet);
+		return;
+	}
+
 	switch (m_noiseType)
 	{
 	case Value:
@@ -482,6 +650,253 @@ void _FastNoiseSIMD::FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet
 	}
 }
 
+// Floats per block of FillNoiseSetHalf, 16KB stays in L1 between the fill and the conversion
+#define HALF_BLOCK_SIZE 4096
+
+void _FastNoiseSIMD::FillNoiseSetHalf(uint16_t* halfSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	int slabSize = ySize * zSize;
+
+	if (xSize <= 0 || slabSize <= 0)
+		return;
+
+	// Blocks are whole x slabs so every block is a contiguous part of the set
+	int xBlock = std::min(xSize, std::max(1, HALF_BLOCK_SIZE / slabSize));
+	float* block = GetEmptySet(xBlock * slabSize);
+
+	for (int x = 0; x < xSize; x += xBlock)
+	{
+		int xCount = std::min(xBlock, xSize - x);
+
+		FillNoiseSet(block, xStart + x, yStart, zStart, xCount, ySize, zSize, scaleModifier);
+		ConvertToHalf(halfSet + x * slabSize, block, xCount * slabSize);
+	}
+
+	FreeNoiseSet(block);
+}
+
+uint16_t _FastNoiseSIMD::FloatToHalf(float value)
+{
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(float));
+
+	uint16_t sign = (bits >> 16) & 0x8000;
+	bits &= 0x7fffffff;
+
+	// Inf and NaN, NaNs stay quiet and keep their top mantissa bits
+	if (bits >= 0x7f800000)
+		return sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 | ((bits >> 13) & 0x3ff) : 0);
+
+	// Rounds past the largest half (65504)
+	if (bits >= 0x477ff000)
+		return sign | 0x7c00;
+
+	uint32_t half;
+	uint32_t shift;
+
+	if (bits >= 0x38800000)
+	{
+		// Normal, rebias the exponent from 127 to 15
+		bits -= 0x38000000;
+		shift = 13;
+	}
+	else
+	{
+		// Subnormal, below 2^-25 everything rounds to 0
+		if (bits < 0x33000000)
+			return sign;
+
+		shift = 126 - (bits >> 23);
+		bits = (bits & 0x7fffff) | 0x800000;
+	}
+
+	// Round to nearest even, a carry out of the mantissa moves up to the next exponent
+	half = bits >> shift;
+	uint32_t remainder = bits & ((1u << shift) - 1);
+	uint32_t halfway = 1u << (shift - 1);
+
+	if (remainder > halfway || (remainder == halfway && (half & 1)))
+		half++;
+
+	return sign | half;
+}
+
+// Heights per block of FillNormalMap, 64KB stays in L2 between the fill and deriving the normals
+#define NORMAL_BLOCK_SIZE 16384
+
+void _FastNoiseSIMD::FillNormalMap(uint8_t* normalMap, int xStart, int yStart, int zStart, int xSize, int zSize, float strength, NormalMapFormat format, float scaleModifier)
+{
+	assert(normalMap);
+
+	if (xSize <= 0 || zSize <= 0)
+		return;
+
+	// Rows are aligned so every block can be filled after the two apron rows carried over from the last one
+	int heightStride = AlignedSize(zSize + 2);
+	int xBlock = std::min(xSize, std::max(1, NORMAL_BLOCK_SIZE / heightStride - 2));
+	int texelSize = format == RG8 ? 2 : 4;
+	float* block = GetEmptySet((xBlock + 2) * heightStride);
+
+	FillNoiseSet(block, xStart - 1, yStart, zStart - 1, 2, 1, heightStride, scaleModifier);
+
+	for (int x = 0; x < xSize; x += xBlock)
+	{
+		int xCount = std::min(xBlock, xSize - x);
+
+		FillNoiseSet(block + 2 * heightStride, xStart + x + 1, yStart, zStart - 1, xCount, 1, heightStride, scaleModifier);
+		FillNormalsFromHeights(normalMap + x * zSize * texelSize, block, heightStride, xCount, zSize, strength, format);
+
+		std::memmove(block, block + xCount * heightStride, 2 * heightStride * sizeof(float));
+	}
+
+	FreeNoiseSet(block);
+}
+
+void _FastNoiseSIMD::FillHeightMap(float* heightMap, int xStart, int yStart, int zStart, int xSize, int zSize, float heightScale, float heightBias, float& minOut, float& maxOut, int rowPitch, float scaleModifier)
+{
+	assert(heightMap);
+
+	minOut = INFINITY;
+	maxOut = -INFINITY;
+
+	if (xSize <= 0 || zSize <= 0)
+		return;
+
+	if (rowPitch <= 0)
+		rowPitch = zSize;
+
+	// Blocks are whole rows, converted a row at a time so rows can be pitched
+	int xBlock = std::min(xSize, std::max(1, HALF_BLOCK_SIZE / zSize));
+	float* block = GetEmptySet(xBlock * zSize);
+
+	for (int x = 0; x < xSize; x += xBlock)
+	{
+		int xCount = std::min(xBlock, xSize - x);
+
+		FillNoiseSet(block, xStart + x, yStart, zStart, xCount, 1, zSize, scaleModifier);
+
+		for (int row = 0; row < xCount; row++)
+			ConvertToHeights(heightMap + (x + row) * rowPitch, block + row * zSize, zSize, heightScale, heightBias, minOut, maxOut);
+	}
+
+	FreeNoiseSet(block);
+}
+
+float* _FastNoiseSIMD::GetChunkSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int apron, FastNoiseChunkCache* chunkCache, float scaleModifier)
+{
+	float* noiseSet = GetEmptySet(xSize + apron * 2, ySize + apron * 2, zSize + apron * 2);
+
+	FillChunkSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, apron, chunkCache, scaleModifier);
+
+	return noiseSet;
+}
+
+void _FastNoiseSIMD::FillChunkSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int apron, FastNoiseChunkCache* chunkCache, float scaleModifier)
+{
+	assert(noiseSet);
+	assert(apron >= 0);
+
+	xStart -= apron;
+	yStart -= apron;
+	zStart -= apron;
+	xSize += apron * 2;
+	ySize += apron * 2;
+	zSize += apron * 2;
+
+	int slabSize = ySize * zSize;
+	int xCached = 0;
+	unsigned int settingsHash = 0;
+
+	if (chunkCache)
+	{
+		settingsHash = GetSettingsHash();
+
+		// Leading slabs of this chunk may be the trailing slabs of the previous one
+		if (chunkCache->slabCount > 0 &&
+			chunkCache->slabY == yStart && chunkCache->slabZ == zStart &&
+			chunkCache->slabYSize == ySize && chunkCache->slabZSize == zSize &&
+			chunkCache->slabScaleModifier == scaleModifier && chunkCache->slabSettingsHash == settingsHash &&
+			xStart >= chunkCache->slabX && xStart < chunkCache->slabX + chunkCache->slabCount)
+		{
+			xCached = std::min(chunkCache->slabX + chunkCache->slabCount - xStart, xSize);
+			memcpy(noiseSet, chunkCache->slabSet + (xStart - chunkCache->slabX) * slabSize, xCached * slabSize * sizeof(float));
+		}
+	}
+
+	if (xCached < xSize)
+		FillChunkSlabs(noiseSet + xCached * slabSize, xStart + xCached, yStart, zStart, xSize - xCached, ySize, zSize, chunkCache, scaleModifier);
+
+	if (chunkCache && apron > 0)
+	{
+		int slabCount = std::min(apron * 2, xSize);
+
+		if (chunkCache->slabCapacity < slabCount * slabSize)
+		{
+			FreeNoiseSet(chunkCache->slabSet);
+			chunkCache->slabCapacity = slabCount * slabSize;
+			chunkCache->slabSet = GetEmptySet(chunkCache->slabCapacity);
+		}
+
+		memcpy(chunkCache->slabSet, noiseSet + (xSize - slabCount) * slabSize, slabCount * slabSize * sizeof(float));
+
+		chunkCache->slabCount = slabCount;
+		chunkCache->slabX = xStart + xSize - slabCount;
+		chunkCache->slabY = yStart;
+		chunkCache->slabZ = zStart;
+		chunkCache->slabYSize = ySize;
+		chunkCache->slabZSize = zSize;
+		chunkCache->slabScaleModifier = scaleModifier;
+		chunkCache->slabSettingsHash = settingsHash;
+	}
+}
+
+void _FastNoiseSIMD::FillChunkSlabs(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, FastNoiseChunkCache* chunkCache, float scaleModifier)
+{
+	// Split at this instance's vector size, AlignedSize() pads to the widest compiled level
+	int zTail = zSize & (m_vectorSize - 1);
+	int zMain = zSize - zTail;
+
+	if (zTail == 0 || zMain == 0)
+	{
+		FillNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+		return;
+	}
+
+	// Generate the vector aligned part of each z row and the tails as separate sets, then interleave them
+	int rowCount = xSize * ySize;
+	int mainSize = AlignedSize(rowCount * zMain);
+	int scratchSize = mainSize + rowCount * zTail;
+	float* scratchSet;
+
+	if (chunkCache)
+	{
+		if (chunkCache->scratchCapacity < scratchSize)
+		{
+			FreeNoiseSet(chunkCache->scratchSet);
+			chunkCache->scratchCapacity = scratchSize;
+			chunkCache->scratchSet = GetEmptySet(scratchSize);
+		}
+		scratchSet = chunkCache->scratchSet;
+	}
+	else
+		scratchSet = GetEmptySet(scratchSize);
+
+	float* tailSet = scratchSet + mainSize;
+
+	FillNoiseSet(scratchSet, xStart, yStart, zStart, xSize, ySize, zMain, scaleModifier);
+	FillNoiseSet(tailSet, xStart, yStart, zStart + zMain, xSize, ySize, zTail, scaleModifier);
+
+	for (int row = 0; row < rowCount; row++)
+	{
+		memcpy(noiseSet, scratchSet + row * zMain, zMain * sizeof(float));
+		memcpy(noiseSet + zMain, tailSet + row * zTail, zTail * sizeof(float));
+		noiseSet += zSize;
+	}
+
+	if (!chunkCache)
+		FreeNoiseSet(scratchSet);
+}
+
 float* _FastNoiseSIMD::GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale)
 {
 	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
@@ -491,6 +906,92 @@ float* _FastNoiseSIMD::GetSampledNoiseSet(int xStart, int yStart, int zStart, in
 	return noiseSet;
 }
 
+int _FastNoiseSIMD::GetSampledScratchSize(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio)
+{
+	int apron = m_sampleInterp == CatmullRom ? 1 : 0;
+	int xGridStart, yGridStart, zGridStart;
+	int xGridSize, yGridSize, zGridSize;
+
+	GetSampledGrid(xStart, xSize, xRatio, apron, xGridStart, xGridSize);
+	GetSampledGrid(yStart, ySize, yRatio, apron, yGridStart, yGridSize);
+	GetSampledGrid(zStart, zSize, zRatio, apron, zGridStart, zGridSize);
+
+	int zPitch = AlignedSize(zSize);
+
+	// Coarse grid noise and positions, then the z and y interpolated passes
+	return AlignedSize(xGridSize * yGridSize * zGridSize) * 4 +
+		xGridSize * yGridSize * zPitch +
+		xGridSize * ySize * zPitch;
+}
+
+void _FastNoiseSIMD::GetSampledGrid(int start, int size, int ratio, int apron, int& gridStart, int& gridSize)
+{
+	int end = start + size - 1;
+
+	// Floor of start / ratio and ceil of end / ratio
+	gridStart = start >= 0 ? start / ratio : -((ratio - 1 - start) / ratio);
+	int gridEnd = end >= 0 ? (end + ratio - 1) / ratio : -(-end / ratio);
+
+	gridStart -= apron;
+	gridSize = gridEnd - gridStart + 1 + apron;
+}
+
+float* _FastNoiseSIMD::GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio, float scaleModifier)
+{
+	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
+	float* scratchSet = GetEmptySet(GetSampledScratchSize(xStart, yStart, zStart, xSize, ySize, zSize, xRatio, yRatio, zRatio));
+
+	FillSampledNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, xRatio, yRatio, zRatio, scratchSet, scaleModifier);
+
+	FreeNoiseSet(scratchSet);
+	return noiseSet;
+}
+
+float* _FastNoiseSIMD::GetCellular2DSet(int xStart, int zStart, int xSize, int zSize, float scaleModifier)
+{
+	float* noiseSet = GetEmptySet(xSize, 1, zSize);
+
+	FillCellular2DSet(noiseSet, xStart, zStart, xSize, zSize, scaleModifier);
+
+	return noiseSet;
+}
+
+int* _FastNoiseSIMD::GetTileHashSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize)
+{
+	int* hashSet = GetEmptyIntSet(xSize * ySize * zSize);
+
+	FillTileHashSet(hashSet, xStart, yStart, zStart, xSize, ySize, zSize);
+
+	return hashSet;
+}
+
+FastNoiseVectorSet* _FastNoiseSIMD::GetWarpedVectorSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	FastNoiseVectorSet* warpedSet = new FastNoiseVectorSet();
+
+	FillWarpedVectorSet(warpedSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+	return warpedSet;
+}
+
+int* _FastNoiseSIMD::GetCellularCellSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	int* cellSet = GetEmptyIntSet(xSize * ySize * zSize);
+
+	FillCellularCellSet(cellSet, nullptr, nullptr, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+	return cellSet;
+}
+
+float* _FastNoiseSIMD::GetThresholdSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float isoLevel, float scaleModifier)
+{
+	float* noiseSet = GetEmptySet(xSize, ySize, zSize);
+
+	FillThresholdSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, isoLevel, scaleModifier);
+
+	return noiseSet;
+}
+
 #define GET_SET(f) \
 float* _FastNoiseSIMD::Get##f##Set(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)\
 {\
@@ -529,6 +1030,106 @@ float _FastNoiseSIMD::CalculateFractalBounding(int octaves, float gain)
 	return 1.0f / ampFractal;
 }
 
+unsigned int _FastNoiseSIMD::GetSettingsHash() const
+{
+	unsigned int hash = 2166136261u;
+
+#define HASH_SETTING(setting) \
+	{\
+		unsigned char bytes[sizeof(setting)];\
+		memcpy(bytes, &setting, sizeof(setting));\
+		for (unsigned int i = 0; i < sizeof(setting); i++)\
+			hash = (hash ^ bytes[i]) * 16777619u;\
+	}
+
+	HASH_SETTING(m_seed)
+	HASH_SETTING(m_frequency)
+	HASH_SETTING(m_noiseType)
+	HASH_SETTING(m_xScale)
+	HASH_SETTING(m_yScale)
+	HASH_SETTING(m_zScale)
+
+	HASH_SETTING(m_octaves)
+	HASH_SETTING(m_lacunarity)
+	HASH_SETTING(m_gain)
+	HASH_SETTING(m_fractalType)
+	HASH_SETTING(m_fractalOffset)
+	HASH_SETTING(m_fractalFeedback)
+
+	HASH_SETTING(m_cellularDistanceFunction)
+	HASH_SETTING(m_cellularReturnType)
+	HASH_SETTING(m_cellularNoiseLookupType)
+	HASH_SETTING(m_cellularNoiseLookupFrequency)
+	HASH_SETTING(m_cellularDistanceIndex0)
+	HASH_SETTING(m_cellularDistanceIndex1)
+	HASH_SETTING(m_cellularJitter)
+
+	HASH_SETTING(m_perturbType)
+	HASH_SETTING(m_perturbAmp)
+	HASH_SETTING(m_perturbFrequency)
+	HASH_SETTING(m_perturbKernel)
+	HASH_SETTING(m_perturbSampleRatio)
+	HASH_SETTING(m_perturbOctaves)
+	HASH_SETTING(m_perturbLacunarity)
+	HASH_SETTING(m_perturbGain)
+	HASH_SETTING(m_perturbNormaliseLength)
+
+	HASH_SETTING(m_sampleInterp)
+	HASH_SETTING(m_precision)
+
+#undef HASH_SETTING
+
+	return hash;
+}
+
+float _FastNoiseSIMD::GetOctaveBound(NoiseType noiseType)
+{
+	switch (noiseType)
+	{
+	case Perlin:
+	case PerlinFractal:
+#ifdef SIMPLEX_ENABLED
+	case Simplex:
+	case SimplexFractal:
+#endif
+		// Gradient noise can slightly exceed 1, the analytic maximum for 3D Perlin is ~1.036
+		return 1.1f;
+	default:
+		// Value noise interpolates values in [-1, 1]
+		// Cubic interpolation weights sum to at most 1.5 per axis, which the cubic bounding cancels
+		return 1.0f;
+	}
+}
+
+bool _FastNoiseSIMD::IsLatticeSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float frequency, int octaves) const
+{
+	if (m_perturbType != None)
+		return false;
+
+	// Later octaves multiply the coordinates by the lacunarity
+	float lacunarity = octaves > 1 ? m_lacunarity : 1.0f;
+
+	if (!std::isfinite(lacunarity) || lacunarity != std::floor(lacunarity))
+		return false;
+
+	float axisFrequency[3] = { frequency * m_xScale, frequency * m_yScale, frequency * m_zScale };
+	int start[3] = { xStart, yStart, zStart };
+	int size[3] = { xSize, ySize, zSize };
+
+	for (int i = 0; i < 3; i++)
+	{
+		if (!std::isfinite(axisFrequency[i]) || axisFrequency[i] != std::floor(axisFrequency[i]))
+			return false;
+
+		// Coordinates must stay exact in a float up to the last octave
+		double extent = std::max(std::abs(double(start[i])), std::abs(double(start[i]) + size[i] - 1));
+
+		if (extent * std::abs(axisFrequency[i]) * std::pow(std::abs(double(lacunarity)), octaves - 1) >= 16777216.0)
+			return false;
+	}
+	return true;
+}
+
 void _FastNoiseSIMD::SetCellularDistance2Indices(int cellularDistanceIndex0, int cellularDistanceIndex1)
 {
 	m_cellularDistanceIndex0 = std::min(cellularDistanceIndex0, cellularDistanceIndex1);
@@ -547,6 +1148,17 @@ void FastNoiseVectorSet::Free()
 	zSet = nullptr;
 }
 
+void FastNoiseChunkCache::Free()
+{
+	_FastNoiseSIMD::FreeNoiseSet(slabSet);
+	_FastNoiseSIMD::FreeNoiseSet(scratchSet);
+	slabSet = nullptr;
+	scratchSet = nullptr;
+	slabCapacity = 0;
+	scratchCapacity = 0;
+	slabCount = 0;
+}
+
 void FastNoiseVectorSet::SetSize(int _size)
 {
 	Free();
@@ -31,17 +31,28 @@
 #ifndef FASTNOISE_SIMD_H__
 #define FASTNOISE_SIMD_H__
 
+#include <atomic>
+#include <cstdint>
+
 // Simplex is disabled as it is protected by a patent until 2022-01-08.
 // https://patents.google.com/patent/US6867776
 // The patent covers using the algorithm for generating textures with specific qualities.
 // Uncomment the line below to enable it and use at your own risk.
 #define SIMPLEX_ENABLED
 
-#if defined(__arm__) || defined(__aarch64__)
+// Bit-identical output on every SIMD level and platform, e.g. for lockstep multiplayer where each client generates
+// the terrain itself. Turns off FMA and float contraction, uses IEEE division and square roots instead of estimates
+// and rounds to nearest even when converting to int on every level. 32bit ARM uses the portable level instead of
+// NEON, which flushes denormals. Coordinates must stay within +-2^31 after scaling, 32bit x86 needs -mfpmath=sse
+//#define FN_DETERMINISTIC
+
+// NEON is only built for Android, other ARM targets (Linux, iOS, macOS) use the portable level below
+#if (defined(__arm__) || defined(__aarch64__)) && defined(__ANDROID__) && !(defined(FN_DETERMINISTIC) && defined(__arm__))
 #define FN_ARM
 //#define FN_IOS
 #define FN_COMPILE_NEON
-#else
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FN_X86
 
 // Comment out lines to not compile for certain instruction sets
 #define FN_COMPILE_SSE2
@@ -54,18 +65,38 @@
 // Only the latest compilers will support this
 #define FN_COMPILE_AVX512
 
+// AVX-512F plus the VL/DQ/BW extensions of Skylake-SP and later, set /arch:AVX512 or
+// -mavx512f -mavx512vl -mavx512dq -mavx512bw on FastNoiseSIMD_avx512skx.cpp
+#define FN_COMPILE_AVX512_SKX
+
 // Using FMA instructions with AVX(51)2/NEON provides a small performance increase but can cause 
 // minute variations in noise output compared to other SIMD levels due to higher calculation precision
 // Intel compiler will always generate FMA instructions, use /Qfma- or -no-fma to disable
+#ifndef FN_DETERMINISTIC
 #define FN_USE_FMA
 #endif
+#endif
+
+// Portable level built on GCC/Clang vector extensions, for targets without one of the levels above or
+// builds with them commented out. Define FN_COMPILE_PORTABLE to also build it next to the native levels,
+// it is then only used when selected with SetSIMDLevel(FN_PORTABLE)
+#if !defined(FN_COMPILE_SSE2) && !defined(FN_COMPILE_NEON) && (defined(__GNUC__) || defined(__clang__))
+#define FN_COMPILE_PORTABLE
+#endif
+
+// Floats per portable vector, must be a power of 2. 4 matches the 128bit registers every SIMD target has,
+// wider vectors get split by the compiler and spill when passed between functions
+#ifndef FN_PORTABLE_VECTOR_SIZE
+#define FN_PORTABLE_VECTOR_SIZE 4
+#endif
 
 // Using aligned sets of memory for float arrays allows faster storing of SIMD data
 // Comment out to allow unaligned float arrays to be used as sets
 #define FN_ALIGNED_SETS
 
 // SSE2/NEON support is guaranteed on 64bit CPUs so no fallback is needed
-#if !(defined(_WIN64) || defined(__x86_64__) || defined(__ppc64__) || defined(__aarch64__) || defined(FN_IOS)) || defined(_DEBUG)
+#if !(defined(_WIN64) || defined(__x86_64__) || defined(__ppc64__) || defined(__aarch64__) || defined(FN_IOS)) || defined(_DEBUG) || \
+	!(defined(FN_COMPILE_SSE2) || defined(FN_COMPILE_NEON) || defined(FN_COMPILE_PORTABLE))
 #define FN_COMPILE_NO_SIMD_FALLBACK
 #endif
 
@@ -103,6 +134,7 @@ Intel Skylake-X - Q2 2017
 */
 
 struct FastNoiseVectorSet;
+struct FastNoiseChunkCache;
 
 class _FastNoiseSIMD
 {
@@ -113,16 +145,38 @@ public:
 #else
 	enum NoiseType { Value, ValueFractal, Perlin, PerlinFractal, WhiteNoise, Cellular, Cubic, CubicFractal };
 #endif
-	enum FractalType { FBM, Billow, RigidMulti };
+	enum FractalType { FBM, Billow, RigidMulti, RigidMultiFeedback, HybridMulti, HeteroTerrain };
 	enum PerturbType { None, Gradient, GradientFractal, Normalise, Gradient_Normalise, GradientFractal_Normalise };
+#ifdef SIMPLEX_ENABLED
+	enum PerturbKernel { LatticeGradient, SimplexGradient };
+#else
+	enum PerturbKernel { LatticeGradient };
+#endif
+
+	enum SampleInterp { Linear, CatmullRom };
+
+	enum NormalMapFormat { RGBA8, RG8 };
+
+	enum Precision { Exact, Fast };
+
+	enum SIMDPolicy { Fastest, PreferAVX2, Calibrate };
 
 	enum CellularDistanceFunction { Euclidean, Manhattan, Natural };
 	enum CellularReturnType { CellValue, Distance, Distance2, Distance2Add, Distance2Sub, Distance2Mul, Distance2Div, Distance2Cave, NoiseLookup };
 
 	// Creates new FastNoiseSIMD for the highest supported instuction set of the CPU 
+	// Uses the calling thread's level if one was set with SetThreadSIMDLevel()
 	static _FastNoiseSIMD* NewFastNoiseSIMD(int seed = 1337);
 
-	// Returns highest detected level of CPU support
+	// Creates new FastNoiseSIMD for a specific SIMD level, without changing the level used by NewFastNoiseSIMD(seed)
+	// Levels that were not compiled resolve to the next lower compiled level, -1 uses GetSIMDLevel()
+	// Instances of different levels can be used side by side, sets from GetEmptySet() work with all of them
+	// Caution: Levels the CPU does not support will crash when used
+	static _FastNoiseSIMD* NewFastNoiseSIMD(int seed, int level);
+
+	// Returns the level used by NewFastNoiseSIMD(), picked by the SIMD policy unless set with SetSIMDLevel()
+	// 7: AVX-512F, VL, DQ & BW
+	// 6: Portable, compiler vector extensions (only level on targets without a native one)
 	// 5: ARM NEON
 	// 4: AVX-512F
 	// 3: AVX2 & FMA3
@@ -132,6 +186,8 @@ public:
 	static int GetSIMDLevel(void);
 
 	// Sets the SIMD level for newly created FastNoiseSIMD objects
+	// 7: AVX-512F, VL, DQ & BW
+	// 6: Portable, compiler vector extensions (if compiled)
 	// 5: ARM NEON
 	// 4: AVX-512F
 	// 3: AVX2 & FMA3
@@ -140,9 +196,26 @@ public:
 	// 0: Fallback, no SIMD support
 	// -1: Auto-detect fastest supported (Default)
 	// Caution: Setting this manually can cause crashes on CPUs that do not support that level
-	// Caution: Changing this after creating FastNoiseSIMD objects has undefined behaviour
+	// Existing FastNoiseSIMD objects keep the level they were created with
 	static void SetSIMDLevel(int level) { s_currentSIMDLevel = level; }
 
+	// Returns the SIMD level this object runs at
+	int GetInstanceSIMDLevel() const { return m_SIMDLevel; }
+
+	// Sets how the level is picked when it is auto-detected, resets the level to auto-detect
+	// Fastest: Highest level the CPU supports
+	// PreferAVX2: Same as Fastest but uses AVX2 instead of AVX-512, which lowers the clock speed of the core on some CPUs
+	// Calibrate: Times a short fill on each supported level on first use and picks the quickest
+	// Default: Fastest
+	static void SetSIMDPolicy(SIMDPolicy policy) { s_SIMDPolicy = policy; s_currentSIMDLevel = -1; }
+	static SIMDPolicy GetSIMDPolicy() { return s_SIMDPolicy; }
+
+	// Overrides the level used by NewFastNoiseSIMD(seed) on the calling thread only
+	// Keeps latency sensitive threads off a level without affecting other threads
+	// -1: No override (Default)
+	static void SetThreadSIMDLevel(int level);
+	static int GetThreadSIMDLevel();
+
 	// Free a noise set from memory
 	static void FreeNoiseSet(float* noiseSet);
 
@@ -152,9 +225,15 @@ public:
 	// Create an empty (aligned) noise set for use with FillNoiseSet()
 	static float* GetEmptySet(int xSize, int ySize, int zSize) { return GetEmptySet(xSize*ySize*zSize); }
 
-	// Rounds the size up to the nearest aligned size for the current SIMD level
+	// Rounds the size up to the nearest aligned size, valid for every compiled SIMD level
 	static int AlignedSize(int size);
 
+	// Free an int set from memory
+	static void FreeIntSet(int* intSet) { FreeNoiseSet(reinterpret_cast<float*>(intSet)); }
+
+	// Create an empty (aligned) int set for use with FillCellularCellSet() or FillTileHashSet()
+	static int* GetEmptyIntSet(int size) { return reinterpret_cast<int*>(GetEmptySet(size)); }
+
 
 	// Returns seed used for all noise types
 	int GetSeed(void) const { return m_seed; }
@@ -198,6 +277,18 @@ public:
 	void SetFractalType(FractalType fractalType) { m_fractalType = fractalType; }
 	FractalType GetFractalType() { return m_fractalType; }
 
+	// Sets the offset added to each octave of the multifractal types (RigidMultiFeedback, HybridMulti, HeteroTerrain)
+	// Ridged octaves are (offset - |noise|)^2, hybrid and hetero terrain octaves are noise + offset
+	// Default: 1.0
+	void SetFractalOffset(float offset) { m_fractalOffset = offset; }
+	float GetFractalOffset() { return m_fractalOffset; }
+
+	// Sets how much each RigidMultiFeedback octave is weighted by the octave before it
+	// The weight is the previous octave times this, clamped to [0, 1], so higher values keep more detail in the ridges
+	// Default: 2.0
+	void SetFractalFeedback(float feedback) { m_fractalFeedback = feedback; }
+	float GetFractalFeedback() { return m_fractalFeedback; }
+
 	// Sets return type from cellular noise calculations
 	// Default: Distance
 	void SetCellularReturnType(CellularReturnType cellularReturnType) { m_cellularReturnType = cellularReturnType; }
@@ -218,6 +309,13 @@ public:
 	void SetCellularNoiseLookupFrequency(float cellularNoiseLookupFrequency) { m_cellularNoiseLookupFrequency = cellularNoiseLookupFrequency; }
 	float GetCellularNoiseLookupFrequency() { return m_cellularNoiseLookupFrequency; }
 
+	// Caches cellular noise lookups per cell during a fill, so the lookup noise is only
+	// evaluated once for each cell instead of once for each value
+	// Output is the same either way, disable if cells are smaller than the sample spacing
+	// Default: true
+	void SetCellularNoiseLookupCache(bool cellularNoiseLookupCache) { m_cellularNoiseLookupCache = cellularNoiseLookupCache; }
+	bool GetCellularNoiseLookupCache() { return m_cellularNoiseLookupCache; }
+
 	// Sets the 2 distance indicies used for distance2 return types
 	// Default: 0, 1
 	// Note: index0 should be lower than index1
@@ -246,6 +344,22 @@ public:
 	void SetPerturbFrequency(float perturbFrequency) { m_perturbFrequency = perturbFrequency; }
 	float GetPerturbFrequency() { return m_perturbFrequency; }
 
+	// Sets the noise the perturb gradient is made from
+	// LatticeGradient interpolates random offsets between integer lattice points with quintic interpolation
+	// SimplexGradient uses a simplex noise per axis, it has no lattice artifacts but costs about twice as much
+	// Default: LatticeGradient
+	void SetPerturbKernel(PerturbKernel perturbKernel) { m_perturbKernel = perturbKernel; }
+	PerturbKernel GetPerturbKernel() { return m_perturbKernel; }
+
+	// Perturbs only every ratio values per axis and trilinearly interpolates the warped coordinates in between
+	// Perturb is usually much smoother than the noise, so a coarse grid looks the same for a fraction of the cost
+	// Keep the ratio well below the perturb wavelength, later perturb fractal octaves are finer
+	// The grid is on multiples of the ratio, so neighbouring sets line up
+	// Applies to FillNoiseSet/GetNoiseSet and FillWarpedVectorSet, the other set functions perturb every value
+	// Default: 1
+	void SetPerturbSampleRatio(int perturbSampleRatio) { m_perturbSampleRatio = perturbSampleRatio < 1 ? 1 : perturbSampleRatio; }
+	int GetPerturbSampleRatio() { return m_perturbSampleRatio; }
+
 
 	// Sets octave count for perturb fractal types
 	// Default: 3
@@ -267,6 +381,25 @@ public:
 	void SetPerturbNormaliseLength(float perturbNormaliseLength) { m_perturbNormaliseLength = perturbNormaliseLength; }
 	float GetPerturbNormaliseLength() { return m_perturbNormaliseLength; }
 
+	// Sets the interpolation between samples for sets sampled with per axis ratios
+	// CatmullRom is smooth across samples, and costs an extra sample on each side of every axis
+	// Default: Linear
+	void SetSampleInterp(SampleInterp sampleInterp) { m_sampleInterp = sampleInterp; }
+	SampleInterp GetSampleInterp() { return m_sampleInterp; }
+
+	// Sets the precision of Value and Perlin noise sets, Fast trades accuracy for speed, e.g. for distant terrain
+	// Fast uses cubic (3t^2 - 2t^3) instead of quintic interpolation, on the same lattice and within the same octave range
+	// Each weight moves by at most 0.054, so an octave moves by at most 0.33 for Value and 0.65 for Perlin (0.19/0.15 measured)
+	// Applies to FillNoiseSet/GetNoiseSet, and GetNoiseBounds() samples the cubic kernel to match them
+	// The other set functions are always exact
+	// Default: Exact
+	void SetPrecision(Precision precision) { m_precision = precision; }
+	Precision GetPrecision() { return m_precision; }
+
+	// Returns a hash of all settings that affect the noise output
+	// Used to invalidate cached noise when settings change
+	unsigned int GetSettingsHash(void) const;
+
 
 	static FastNoiseVectorSet* GetVectorSet(int xSize, int ySize, int zSize);
 	static FastNoiseVectorSet* GetSamplingVectorSet(int sampleScale, int xSize, int ySize, int zSize);
@@ -277,14 +410,77 @@ public:
 	void FillNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	void FillNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f);
 
+	// Warped vector sets, the coordinates noise is sampled at once the perturb settings are applied
+	// Coordinates are in set units like cell points, the set is marked as warped so FillNoiseSet with it doesn't perturb again
+	// The warp is computed once and can be shared by any number of noise layers, or used to warp mesh positions
+	// The vector set overload warps arbitrary points, warpedSet can be vectorSet to warp it in place
+	// Frequency and axis scales must not be 0
+	FastNoiseVectorSet* GetWarpedVectorSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
+	virtual void FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) = 0;
+	virtual void FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
+
+	// Half precision (IEEE 754 binary16) sets, FillNoiseSet values rounded to the nearest half
+	// Noise is generated in blocks that stay in cache and converted before being stored, so only half the bytes reach memory
+	// The set needs no alignment or padding and holds xSize * ySize * zSize values
+	void FillNoiseSetHalf(uint16_t* halfSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
+
+	// Converts floats to half precision, rounding to nearest even like F16C which is used on the AVX2 and AVX-512 levels
+	virtual void ConvertToHalf(uint16_t* halfSet, const float* floatSet, int size) = 0;
+	static uint16_t FloatToHalf(float value);
+
+	// Normal maps from the heights of a noise slice at yStart, xSize rows of zSize texels
+	// Heights are the noise values times strength, in texels, and the normals are taken from the central differences
+	// Rows are generated in blocks with a one texel apron and the normals are derived while each block is in cache
+	// RGBA8 texels are 4 bytes with alpha 255, RG8 texels are 2 bytes and leave z to be reconstructed
+	// Components map [-1, 1] to [0, 255], texture y points along -x so the map is +Y up like Image::bump_map_to_normal_map
+	void FillNormalMap(uint8_t* normalMap, int xStart, int yStart, int zStart, int xSize, int zSize, float strength, NormalMapFormat format = RGBA8, float scaleModifier = 1.0f);
+
+	// Normal map texels from a height set with a one value apron, xSize + 2 rows each heightStride long
+	// heightStride must be at least zSize + 2, heights outside the apron are ignored
+	virtual void FillNormalsFromHeights(uint8_t* normalMap, const float* heightSet, int heightStride, int xSize, int zSize, float strength, NormalMapFormat format = RGBA8) = 0;
+
+	// Height maps for heightmap collision shapes, a noise slice at yStart with each value scaled by heightScale and offset by heightBias
+	// xSize rows of zSize heights like the rows of a HeightMapShape3D, rowPitch floats apart or packed if rowPitch is 0
+	// The heights are converted while each block of noise is in cache, minOut and maxOut return their range
+	// The set needs no alignment or padding
+	void FillHeightMap(float* heightMap, int xStart, int yStart, int zStart, int xSize, int zSize, float heightScale, float heightBias, float& minOut, float& maxOut, int rowPitch = 0, float scaleModifier = 1.0f);
+
+	// heightSet = floatSet * heightScale + heightBias, minOut and maxOut are widened to the range of the heights
+	virtual void ConvertToHeights(float* heightSet, const float* floatSet, int size, float heightScale, float heightBias, float& minOut, float& maxOut) = 0;
+
+	// Chunk sets have an apron of extra samples on every side, for meshing across chunk borders
+	// The set starts at (xStart - apron, yStart - apron, zStart - apron) and has a size of (xSize + 2 * apron) * (ySize + 2 * apron) * (zSize + 2 * apron)
+	// The z axis is generated as a vector aligned run and a separate tail, so padded sizes never take the slow set builder path
+	// A chunk cache can be passed to reuse the overlapping x border slabs when chunks are generated in +x order
+	float* GetChunkSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int apron, FastNoiseChunkCache* chunkCache = nullptr, float scaleModifier = 1.0f);
+	void FillChunkSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int apron, FastNoiseChunkCache* chunkCache = nullptr, float scaleModifier = 1.0f);
+
 	float* GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale);
 	virtual void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale) = 0;
 	virtual void FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 
+	// Sampled sets with an integer ratio per axis, noise is only generated on a coarse grid at multiples of the ratios and interpolated in between
+	// Values on the coarse grid match GetNoiseSet, the scratch set must hold GetSampledScratchSize() floats and can be reused between calls
+	// Only the scratch set needs to be allocated with GetEmptySet, the noise set can be any float array of xSize * ySize * zSize
+	// See SetSampleInterp() for the interpolation
+	int GetSampledScratchSize(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio);
+	float* GetSampledNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio, float scaleModifier = 1.0f);
+	virtual void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio, float* scratchSet, float scaleModifier = 1.0f) = 0;
+
 	float* GetWhiteNoiseSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	virtual void FillWhiteNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) = 0;
 	virtual void FillWhiteNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 
+	// Integer hashes of each lattice point, white noise is this hash / 2^31
+	// For procedural tile IDs, like GetWhiteNoiseSet the start and size are lattice coordinates and the frequency is ignored
+	// Allocate the set with GetEmptyIntSet(xSize * ySize * zSize)
+	int* GetTileHashSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize);
+	virtual void FillTileHashSet(int* hashSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize) = 0;
+
+	// 2D tile hashes in the X/Z plane, laid out like a 3D set with ySize = 1
+	int* GetTileHash2DSet(int xStart, int zStart, int xSize, int zSize) { return GetTileHashSet(xStart, 0, zStart, xSize, 1, zSize); }
+	void FillTileHash2DSet(int* hashSet, int xStart, int zStart, int xSize, int zSize) { FillTileHashSet(hashSet, xStart, 0, zStart, xSize, 1, zSize); }
+
 	float* GetValueSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	float* GetValueFractalSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	virtual void FillValueSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) = 0;
@@ -309,6 +505,20 @@ public:
 	float* GetCellularSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	virtual void FillCellularSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) = 0;
 	virtual void FillCellularSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
+
+	// 2D Cellular noise in the X/Z plane, laid out like a 3D set with ySize = 1
+	// Cell points are placed in 2D, so it only searches 9 cells per value instead of 27
+	// This is different noise to a slice of GetCellularSet, not a faster version of it
+	float* GetCellular2DSet(int xStart, int zStart, int xSize, int zSize, float scaleModifier = 1.0f);
+	virtual void FillCellular2DSet(float* noiseSet, int xStart, int zStart, int xSize, int zSize, float scaleModifier = 1.0f) = 0;
+
+	// Cellular cell sets, from the same search as FillCellularSet with the current distance function and jitter
+	// cellSet receives the hash of the closest cell, an ID for the region (CellValue is this ID / 2^31)
+	// pointSet and point2Set are optional, and receive the closest and second closest cell points in set coordinates
+	// Points are SoA like FastNoiseVectorSet: x, y then z values, each AlignedSize(xSize * ySize * zSize) long
+	// Allocate the cell set with GetEmptyIntSet(xSize * ySize * zSize) and point sets with GetEmptySet(AlignedSize(xSize * ySize * zSize) * 3)
+	int* GetCellularCellSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
+	virtual void FillCellularCellSet(int* cellSet, float* pointSet, float* point2Set, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) = 0;
 	
 	float* GetCubicSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
 	float* GetCubicFractalSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f);
@@ -317,9 +527,22 @@ public:
 	virtual void FillCubicSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 	virtual void FillCubicFractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) = 0;
 
+	// Fills the set with 1.0 where the noise is above isoLevel and 0.0 elsewhere
+	// Fractal noise types stop evaluating octaves once the remaining octaves can't move any value in the vector across isoLevel
+	// The multifractal types (RigidMultiFeedback, HybridMulti, HeteroTerrain) evaluate every octave
+	float* GetThresholdSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float isoLevel, float scaleModifier = 1.0f);
+	virtual void FillThresholdSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float isoLevel, float scaleModifier = 1.0f) = 0;
+
+	// Gets a guaranteed min and max of the noise set for the same parameters, without filling it
+	// Returns false if the noise type has no bounds (Cellular)
+	// Regions that can't cross an iso level can be skipped, bounds are tighter for smaller regions
+	virtual bool GetNoiseBounds(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float& minOut, float& maxOut, float scaleModifier = 1.0f) = 0;
+
 	virtual ~_FastNoiseSIMD() { }
 
 protected:
+	int m_SIMDLevel = 0;
+	int m_vectorSize = 1;
 	int m_seed = 1337;
 	float m_frequency = 0.01f;
 	NoiseType m_noiseType = Value;	// Godot: Change from default SimplexFractal
@@ -333,11 +556,14 @@ protected:
 	float m_gain = 0.5f;
 	FractalType m_fractalType = FBM;	
 	float m_fractalBounding;	
+	float m_fractalOffset = 1.0f;
+	float m_fractalFeedback = 2.0f;
 
 	CellularDistanceFunction m_cellularDistanceFunction = Euclidean;
 	CellularReturnType m_cellularReturnType = Distance;
 	NoiseType m_cellularNoiseLookupType = Value;	// Godot: change from Simplex default
 	float m_cellularNoiseLookupFrequency = 0.2f;
+	bool m_cellularNoiseLookupCache = true;
 	int m_cellularDistanceIndex0 = 0;
 	int m_cellularDistanceIndex1 = 1;
 	float m_cellularJitter = 0.45f;
@@ -345,6 +571,8 @@ protected:
 	PerturbType m_perturbType = None;
 	float m_perturbAmp = 1.0f;
 	float m_perturbFrequency = 0.5f;
+	PerturbKernel m_perturbKernel = LatticeGradient;
+	int m_perturbSampleRatio = 1;
 
 	int m_perturbOctaves = 3;
 	float m_perturbLacunarity = 2.0f;
@@ -352,8 +580,27 @@ protected:
 	float m_perturbFractalBounding;
 	float m_perturbNormaliseLength = 1.0f;
 
-	static int s_currentSIMDLevel;
+	SampleInterp m_sampleInterp = Linear;
+	Precision m_precision = Exact;
+
+	// Atomic so threads creating instances concurrently all see one selected level
+	static std::atomic<int> s_currentSIMDLevel;
+	static std::atomic<SIMDPolicy> s_SIMDPolicy;
 	static float CalculateFractalBounding(int octaves, float gain);
+
+	// Upper bound of the absolute value of a single octave of the noise type
+	static float GetOctaveBound(NoiseType noiseType);
+
+	// True if every sample of the set lands exactly on the integer lattice, for all octaves
+	// Lattice noise there is just the corner value, so Value and Cubic sets can skip interpolation
+	// frequency is the fill's scaleModifier * m_frequency, pass 1 octave for non fractal sets
+	bool IsLatticeSet(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float frequency, int octaves) const;
+
+	// Coarse grid covering start to start + size - 1 on one axis of a sampled set, plus apron samples on each side
+	static void GetSampledGrid(int start, int size, int ratio, int apron, int& gridStart, int& gridSize);
+
+private:
+	void FillChunkSlabs(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, FastNoiseChunkCache* chunkCache, float scaleModifier);
 };
 
 struct FastNoiseVectorSet
@@ -364,6 +611,12 @@ public:
 	float* ySet = nullptr;
 	float* zSet = nullptr;
 
+	// Set by FillWarpedVectorSet, noise sets filled from a warped vector set skip perturb
+	bool warped = false;
+
+	// Multiplies the frequency like the scaleModifier of grid sets, so positions on the same grid give the same values
+	float scaleModifier = 1.0f;
+
 	// Only used for sampled vector sets
 	int sampleScale = 0;
 	int sampleSizeX = -1;
@@ -381,6 +634,35 @@ public:
 	void SetSize(int _size);
 };
 
+struct FastNoiseChunkCache
+{
+public:
+	// Trailing x slabs of the last generated chunk
+	float* slabSet = nullptr;
+	int slabCapacity = 0;
+	int slabCount = 0;
+	int slabX = 0;
+	int slabY = 0;
+	int slabZ = 0;
+	int slabYSize = 0;
+	int slabZSize = 0;
+	float slabScaleModifier = 0.0f;
+	unsigned int slabSettingsHash = 0;
+
+	// Scratch memory for splitting the z axis of a chunk
+	float* scratchSet = nullptr;
+	int scratchCapacity = 0;
+
+	FastNoiseChunkCache() {}
+
+	~FastNoiseChunkCache() { Free(); }
+
+	void Free();
+
+	// Discards the cached slabs, memory is kept for reuse
+	void Clear() { slabCount = 0; }
+};
+
 #define FN_CELLULAR_INDEX_MAX 3
 
 #define FN_NO_SIMD_FALLBACK 0
@@ -389,5 +671,7 @@ public:
 #define FN_AVX2 3
 #define FN_AVX512 4
 #define FN_NEON 5
+#define FN_PORTABLE 6
+#define FN_AVX512_SKX 7
 
 #endif
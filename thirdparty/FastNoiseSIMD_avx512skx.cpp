@@ -0,0 +1,53 @@
+// FastNoiseSIMD_avx512skx.cpp
+//
+// MIT License
+//
+// Copyright(c) 2017 Jordan Peck
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The developer's email is jorzixdan.me2@gzixmail.com (for great email, take
+// off every 'zix'.)
+//
+
+#include "FastNoiseSIMD.h"
+
+// DISABLE WHOLE PROGRAM OPTIMIZATION for this file when using MSVC
+
+// To compile AVX512 SKX support enable AVX-512 VL/DQ/BW code generation compiler flags for this file
+#ifdef FN_COMPILE_AVX512_SKX
+#if !defined(__AVX512VL__) || !defined(__AVX512DQ__) || !defined(__AVX512BW__)
+#ifdef __GNUC__
+#error To compile AVX512 SKX add build command "-mavx512f -mavx512vl -mavx512dq -mavx512bw" on FastNoiseSIMD_avx512skx.cpp, or remove "#define FN_COMPILE_AVX512_SKX" from FastNoiseSIMD.h
+#else
+#error To compile AVX512 SKX set C++ code generation to use /arch:AVX512 on FastNoiseSIMD_avx512skx.cpp, or remove "#define FN_COMPILE_AVX512_SKX" from FastNoiseSIMD.h
+#endif
+#endif
+
+#define SIMD_LEVEL_H FN_AVX512_SKX
+#include "FastNoiseSIMD_internal.h"
+#ifdef _WIN32
+#include <intrin.h> //AVX512
+#else
+#include <x86intrin.h> //AVX512
+#endif
+
+#define SIMD_LEVEL FN_AVX512_SKX
+#include "FastNoiseSIMD_internal.cpp"
+#endif
@@ -28,6 +28,9 @@
 
 #include "FastNoiseSIMD.h"
 #include <assert.h> 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #if defined(SIMD_LEVEL) || defined(FN_COMPILE_NO_SIMD_FALLBACK)
 
@@ -55,6 +58,27 @@
 #define VECTORCALL
 #endif
 
+// Keeps an optional kernel out of line, so it isn't copied into every set builder
+#if defined(_MSC_VER)
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE __attribute__((noinline))
+#endif
+
+// Stop the compiler fusing a multiply and an add into an FMA, only some levels would round once
+#ifdef FN_DETERMINISTIC
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+#endif
+
+// Both AVX-512 levels share the AVX-512F code, SKX adds VL/DQ/BW instructions on top of it
+#define SIMD_LEVEL_AVX512 (SIMD_LEVEL == FN_AVX512 || SIMD_LEVEL == FN_AVX512_SKX)
+
 // Typedefs
 #if SIMD_LEVEL == FN_NEON
 #define VECTOR_SIZE 4
@@ -66,7 +90,19 @@ typedef int32x4_t SIMDi;
 #define SIMDi_SET(a) vdupq_n_s32(a)
 #define SIMDi_SET_ZERO() vdupq_n_s32(0)
 
-#elif SIMD_LEVEL == FN_AVX512
+#elif SIMD_LEVEL == FN_PORTABLE
+#define VECTOR_SIZE FN_PORTABLE_VECTOR_SIZE
+#define MEMORY_ALIGNMENT (VECTOR_SIZE * 4)
+typedef float SIMDf __attribute__((vector_size(VECTOR_SIZE * 4)));
+typedef int SIMDi __attribute__((vector_size(VECTOR_SIZE * 4)));
+typedef unsigned SIMDu __attribute__((vector_size(VECTOR_SIZE * 4)));
+#define SIMDf_SET(a) (SIMDf{} + (float)(a))
+#define SIMDf_SET_ZERO() (SIMDf{})
+#define SIMDi_SET(a) (SIMDi{} + (int)(a))
+#define SIMDi_SET_ZERO() (SIMDi{})
+static_assert((VECTOR_SIZE & (VECTOR_SIZE - 1)) == 0, "FN_PORTABLE_VECTOR_SIZE must be a power of 2");
+
+#elif SIMD_LEVEL_AVX512
 #define VECTOR_SIZE 16
 #define MEMORY_ALIGNMENT 64
 typedef __m512 SIMDf;
@@ -107,18 +143,6 @@ typedef int SIMDi;
 #define SIMDi_SET_ZERO() (0)
 #endif
 
-// Memory Allocation
-#if SIMD_LEVEL > FN_NO_SIMD_FALLBACK && defined(FN_ALIGNED_SETS)
-#ifdef _WIN32
-#define SIMD_ALLOCATE_SET(floatP, floatCount) floatP = (float*)_aligned_malloc((floatCount)* sizeof(float), MEMORY_ALIGNMENT)
-#else
-#include <cstdlib>
-#define SIMD_ALLOCATE_SET(floatP, floatCount) posix_memalign((void**)&floatP, MEMORY_ALIGNMENT, (floatCount)* sizeof(float))
-#endif
-#else
-#define SIMD_ALLOCATE_SET(floatP, floatCount) floatP = new float[floatCount]
-#endif
-
 union uSIMDf
 {
 	SIMDf m;
@@ -131,7 +155,7 @@ union uSIMDi
 	int a[VECTOR_SIZE];
 };
 
-#if SIMD_LEVEL == FN_AVX512
+#if SIMD_LEVEL_AVX512
 typedef __mmask16 MASK;
 #else
 typedef SIMDi MASK;
@@ -146,18 +170,30 @@ static SIMDf SIMDf_NUM(1);
 
 #define SIMDf_STORE(p,a) vst1q_f32(p, a)
 #define SIMDf_LOAD(p) vld1q_f32(p)
+#define SIMDf_STORE_UNALIGNED(p,a) vst1q_f32(p, a)
+#define SIMDf_LOAD_UNALIGNED(p) vld1q_f32(p)
 
 #define SIMDf_UNDEFINED() SIMDf_SET(0)
 #define SIMDi_UNDEFINED() SIMDi_SET(0)
 
 #define SIMDf_CONVERT_TO_FLOAT(a) vcvtq_f32_s32(a)
 #define SIMDf_CAST_TO_FLOAT(a) vreinterpretq_f32_s32(a)
+#ifdef FN_DETERMINISTIC
+// Round to nearest even like cvtps2dq, deterministic builds only use NEON on AArch64
+#define SIMDi_CONVERT_TO_INT(a) vcvtnq_s32_f32(a)
+#else
 #define SIMDi_CONVERT_TO_INT(a) vcvtq_s32_f32(a)
+#endif
 #define SIMDi_CAST_TO_INT(a) vreinterpretq_s32_f32(a)
 
 #define SIMDf_ADD(a,b) vaddq_f32(a,b)
 #define SIMDf_SUB(a,b) vsubq_f32(a,b)
 #define SIMDf_MUL(a,b) vmulq_f32(a,b)
+#define SIMDf_SQRT(a) vsqrtq_f32(a)
+
+#ifdef FN_DETERMINISTIC
+#define SIMDf_DIV(a,b) vdivq_f32(a,b)
+#else
 #define SIMDf_DIV(a,b) FUNC(DIV)(a,b)
 
 static SIMDf VECTORCALL FUNC(DIV)(SIMDf a, SIMDf b)
@@ -171,6 +207,7 @@ static SIMDf VECTORCALL FUNC(DIV)(SIMDf a, SIMDf b)
 	// and finally, compute a/b = a*(1/b)
 	return vmulq_f32(a, reciprocal);
 }
+#endif
 
 #define SIMDf_MIN(a,b) vminq_f32(a,b)
 #define SIMDf_MAX(a,b) vmaxq_f32(a,b)
@@ -221,7 +258,137 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDi_GREATER_THAN(a,b) vreinterpretq_s32_u32(vcgtq_s32(a,b))
 #define SIMDi_LESS_THAN(a,b) vreinterpretq_s32_u32(vcltq_s32(a,b))
 
-#elif SIMD_LEVEL == FN_AVX512
+#elif SIMD_LEVEL == FN_PORTABLE
+
+// Vector loads/stores through memcpy, compilers turn these into single (unaligned) vector moves
+static SIMDf VECTORCALL FUNC(LOAD)(const float* p)
+{
+	SIMDf a;
+	std::memcpy(&a, p, sizeof(SIMDf));
+	return a;
+}
+
+static void VECTORCALL FUNC(STORE)(float* p, SIMDf a)
+{
+	std::memcpy(p, &a, sizeof(SIMDf));
+}
+
+#define SIMDf_STORE(p,a) FUNC(STORE)(p,a)
+#define SIMDf_LOAD(p) FUNC(LOAD)(p)
+#define SIMDf_STORE_UNALIGNED(p,a) FUNC(STORE)(p,a)
+#define SIMDf_LOAD_UNALIGNED(p) FUNC(LOAD)(p)
+
+#define SIMDf_UNDEFINED() SIMDf_SET_ZERO()
+#define SIMDi_UNDEFINED() SIMDi_SET_ZERO()
+
+#define SIMDf_CAST_TO_FLOAT(a) ((SIMDf)(a))
+#define SIMDi_CAST_TO_INT(a) ((SIMDi)(a))
+
+#if defined(__clang__) || __GNUC__ >= 9
+#define SIMDf_CONVERT_TO_FLOAT(a) __builtin_convertvector(a, SIMDf)
+#define SIMDi_TRUNCATE(a) __builtin_convertvector(a, SIMDi)
+#else
+static SIMDf VECTORCALL FUNC(CONVERT_TO_FLOAT)(SIMDi a)
+{
+	SIMDf r;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		r[i] = static_cast<float>(a[i]);
+	return r;
+}
+
+static SIMDi VECTORCALL FUNC(TRUNCATE)(SIMDf a)
+{
+	SIMDi r;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		r[i] = static_cast<int>(a[i]);
+	return r;
+}
+#define SIMDf_CONVERT_TO_FLOAT(a) FUNC(CONVERT_TO_FLOAT)(a)
+#define SIMDi_TRUNCATE(a) FUNC(TRUNCATE)(a)
+#endif
+
+#define SIMDf_ADD(a,b) ((a) + (b))
+#define SIMDf_SUB(a,b) ((a) - (b))
+#define SIMDf_MUL(a,b) ((a) * (b))
+#define SIMDf_DIV(a,b) ((a) / (b))
+
+#define SIMDf_LESS_THAN(a,b) ((SIMDi)((a) < (b)))
+#define SIMDf_GREATER_THAN(a,b) ((SIMDi)((a) > (b)))
+#define SIMDf_LESS_EQUAL(a,b) ((SIMDi)((a) <= (b)))
+#define SIMDf_GREATER_EQUAL(a,b) ((SIMDi)((a) >= (b)))
+
+#define SIMDf_AND(a,b) SIMDf_CAST_TO_FLOAT(SIMDi_CAST_TO_INT(a) & SIMDi_CAST_TO_INT(b))
+#define SIMDf_AND_NOT(a,b) SIMDf_CAST_TO_FLOAT(~SIMDi_CAST_TO_INT(a) & SIMDi_CAST_TO_INT(b))
+#define SIMDf_XOR(a,b) SIMDf_CAST_TO_FLOAT(SIMDi_CAST_TO_INT(a) ^ SIMDi_CAST_TO_INT(b))
+
+static SIMDf VECTORCALL FUNC(BLENDV)(SIMDf a, SIMDf b, SIMDi mask)
+{
+	return SIMDf_CAST_TO_FLOAT((SIMDi_CAST_TO_INT(a) & ~mask) | (SIMDi_CAST_TO_INT(b) & mask));
+}
+#define SIMDf_BLENDV(a,b,mask) FUNC(BLENDV)(a,b,mask)
+
+// Same operand order as minps/maxps, the second operand is returned for NaN
+#define SIMDf_MIN(a,b) FUNC(BLENDV)(b,a,SIMDf_LESS_THAN(a,b))
+#define SIMDf_MAX(a,b) FUNC(BLENDV)(b,a,SIMDf_GREATER_THAN(a,b))
+
+#define SIMDf_ABS(a) SIMDf_AND(a,SIMDf_CAST_TO_FLOAT(SIMDi_NUM(0x7fffffff)))
+
+static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
+{
+	SIMDf fval = SIMDf_CONVERT_TO_FLOAT(SIMDi_TRUNCATE(a));
+
+	return fval - SIMDf_AND(SIMDf_CAST_TO_FLOAT(SIMDf_LESS_THAN(a, fval)), SIMDf_NUM(1));
+}
+#define SIMDf_FLOOR(a) FUNC(FLOOR)(a)
+
+// Round to nearest even like cvtps2dq, adding and removing 2^23 drops the fraction of the magnitude
+// From 2^23 on every float is a whole number and is converted as is
+static SIMDi VECTORCALL FUNC(CONVERT_TO_INT)(SIMDf a)
+{
+	SIMDf absA = SIMDf_AND(a, SIMDf_CAST_TO_FLOAT(SIMDi_SET(0x7fffffff)));
+	SIMDf rounded = FUNC(BLENDV)(absA, (absA + 8388608.0f) - 8388608.0f, SIMDf_LESS_THAN(absA, SIMDf_SET(8388608.0f)));
+
+	return SIMDi_TRUNCATE(SIMDf_XOR(rounded, SIMDf_XOR(a, absA)));
+}
+#define SIMDi_CONVERT_TO_INT(a) FUNC(CONVERT_TO_INT)(a)
+
+static SIMDf VECTORCALL FUNC(SQRT)(SIMDf a)
+{
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		a[i] = sqrtf(a[i]);
+	return a;
+}
+#define SIMDf_SQRT(a) FUNC(SQRT)(a)
+
+// Integer math goes through unsigned lanes so overflow wraps like the other levels
+#define SIMDi_ADD(a,b) ((SIMDi)((SIMDu)(a) + (SIMDu)(b)))
+#define SIMDi_SUB(a,b) ((SIMDi)((SIMDu)(a) - (SIMDu)(b)))
+#define SIMDi_MUL(a,b) ((SIMDi)((SIMDu)(a) * (SIMDu)(b)))
+
+#define SIMDi_AND(a,b) ((a) & (b))
+#define SIMDi_AND_NOT(a,b) (~(a) & (b))
+#define SIMDi_OR(a,b) ((a) | (b))
+#define SIMDi_XOR(a,b) ((a) ^ (b))
+#define SIMDi_NOT(a) (~(a))
+
+#define SIMDi_SHIFT_R(a,b) ((a) >> (b))
+#define SIMDi_SHIFT_L(a,b) ((SIMDi)((SIMDu)(a) << (b)))
+
+#define SIMDi_EQUAL(a,b) ((SIMDi)((a) == (b)))
+#define SIMDi_GREATER_THAN(a,b) ((SIMDi)((a) > (b)))
+#define SIMDi_LESS_THAN(a,b) ((SIMDi)((a) < (b)))
+
+// Same approximation as the fallback level
+static SIMDf VECTORCALL FUNC(INV_SQRT)(SIMDf x)
+{
+	SIMDf xhalf = x * 0.5f;
+	SIMDi i = SIMDi_SUB(SIMDi_SET(0x5f3759df), SIMDi_SHIFT_R(SIMDi_CAST_TO_INT(x), 1));
+	x = SIMDf_CAST_TO_FLOAT(i);
+	return x * (1.5f - xhalf * x * x);
+}
+#define SIMDf_INV_SQRT(a) FUNC(INV_SQRT)(a)
+
+#elif SIMD_LEVEL_AVX512
 
 #ifdef FN_ALIGNED_SETS
 #define SIMDf_STORE(p,a) _mm512_store_ps(p,a)
@@ -230,6 +397,8 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_STORE(p,a) _mm512_storeu_ps(p,a)
 #define SIMDf_LOAD(p) _mm512_loadu_ps(p)
 #endif
+#define SIMDf_STORE_UNALIGNED(p,a) _mm512_storeu_ps(p,a)
+#define SIMDf_LOAD_UNALIGNED(p) _mm512_loadu_ps(p)
 
 #define SIMDf_UNDEFINED() _mm512_undefined_ps()
 #define SIMDi_UNDEFINED() _mm512_undefined_epi32()
@@ -238,6 +407,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_SUB(a,b) _mm512_sub_ps(a,b)
 #define SIMDf_MUL(a,b) _mm512_mul_ps(a,b)
 #define SIMDf_DIV(a,b) _mm512_div_ps(a,b)
+#define SIMDf_SQRT(a) _mm512_sqrt_ps(a)
 
 #define SIMDf_MIN(a,b) _mm512_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm512_max_ps(a,b)
@@ -283,6 +453,15 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDi_CONVERT_TO_INT(a) _mm512_cvtps_epi32(a)
 #define SIMDi_CAST_TO_INT(a) _mm512_castps_si512(a)
 
+#if SIMD_LEVEL == FN_AVX512_SKX
+// Lattice coordinates straight from a with round down embedded in vcvtps2dq, so they don't wait on the floor
+// vreduceps would give a - floor(a) directly too, but it rounds the difference down and changes the output
+#define SIMDi_CONVERT_FLOOR_TO_INT(a,floorA) _mm512_cvt_roundps_epi32(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)
+
+// a ^ b ^ c in one vpternlogd
+#define SIMDi_XOR3(a,b,c) _mm512_ternarylogic_epi32(a,b,c,0x96)
+#endif
+
 #elif SIMD_LEVEL == FN_AVX2
 
 #ifdef FN_ALIGNED_SETS
@@ -292,6 +471,8 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_STORE(p,a) _mm256_storeu_ps(p,a)
 #define SIMDf_LOAD(p) _mm256_loadu_ps(p)
 #endif
+#define SIMDf_STORE_UNALIGNED(p,a) _mm256_storeu_ps(p,a)
+#define SIMDf_LOAD_UNALIGNED(p) _mm256_loadu_ps(p)
 
 #define SIMDf_UNDEFINED() _mm256_undefined_ps()
 #define SIMDi_UNDEFINED() _mm256_undefined_si256()
@@ -305,6 +486,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_SUB(a,b) _mm256_sub_ps(a,b)
 #define SIMDf_MUL(a,b) _mm256_mul_ps(a,b)
 #define SIMDf_DIV(a,b) _mm256_div_ps(a,b)
+#define SIMDf_SQRT(a) _mm256_sqrt_ps(a)
 
 #define SIMDf_MIN(a,b) _mm256_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm256_max_ps(a,b)
@@ -350,6 +532,8 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_STORE(p,a) _mm_storeu_ps(p,a)
 #define SIMDf_LOAD(p) _mm_loadu_ps(p)
 #endif
+#define SIMDf_STORE_UNALIGNED(p,a) _mm_storeu_ps(p,a)
+#define SIMDf_LOAD_UNALIGNED(p) _mm_loadu_ps(p)
 
 #define SIMDf_UNDEFINED() SIMDf_SET_ZERO()
 #define SIMDi_UNDEFINED() SIMDi_SET_ZERO()
@@ -363,6 +547,7 @@ static SIMDf VECTORCALL FUNC(FLOOR)(SIMDf a)
 #define SIMDf_SUB(a,b) _mm_sub_ps(a,b)
 #define SIMDf_MUL(a,b) _mm_mul_ps(a,b)
 #define SIMDf_DIV(a,b) _mm_div_ps(a,b)
+#define SIMDf_SQRT(a) _mm_sqrt_ps(a)
 
 #define SIMDf_MIN(a,b) _mm_min_ps(a,b)
 #define SIMDf_MAX(a,b) _mm_max_ps(a,b)
@@ -428,6 +613,8 @@ static float FUNC(CAST_TO_FLOAT)(int i) { return *reinterpret_cast<float*>(&i);
 
 #define SIMDf_STORE(p,a) (*(p) = a)
 #define SIMDf_LOAD(p) (*p)
+#define SIMDf_STORE_UNALIGNED(p,a) (*(p) = a)
+#define SIMDf_LOAD_UNALIGNED(p) (*p)
 
 #define SIMDf_UNDEFINED() (0)
 #define SIMDi_UNDEFINED() (0)
@@ -450,6 +637,7 @@ static float FUNC(INV_SQRT)(float x)
 	return x;
 }
 #define SIMDf_INV_SQRT(a) FUNC(INV_SQRT)(a)
+#define SIMDf_SQRT(a) sqrtf(a)
 
 #define SIMDf_LESS_THAN(a,b) (((a) < (b)) ? 0xFFFFFFFF : 0)
 #define SIMDf_GREATER_THAN(a,b) (((a) > (b)) ? 0xFFFFFFFF : 0)
@@ -482,7 +670,12 @@ static float FUNC(INV_SQRT)(float x)
 #define SIMDi_GREATER_THAN(a,b) (((a) > (b)) ? 0xFFFFFFFF : 0)
 #define SIMDi_LESS_THAN(a,b) (((a) < (b)) ? 0xFFFFFFFF : 0)
 
+#ifdef FN_DETERMINISTIC
+// Round to nearest even like cvtps2dq, roundf rounds halfway cases away from zero
+#define SIMDi_CONVERT_TO_INT(a) static_cast<int>(rintf(a))
+#else
 #define SIMDi_CONVERT_TO_INT(a) static_cast<int>(roundf(a))
+#endif
 #define SIMDf_CONVERT_TO_FLOAT(a) static_cast<float>(a)
 #endif
 
@@ -491,7 +684,7 @@ static float FUNC(INV_SQRT)(float x)
 //#define SIMDi_LESS_EQUAL(a,b) SIMDi_NOT(SIMDi_GREATER_THAN(a,b))
 //#define SIMDi_BLENDV(a,b, mask) SIMDi_CAST_TO_INT(SIMDf_BLENDV(SIMDf_CAST_TO_FLOAT(a),SIMDf_CAST_TO_FLOAT(b),SIMDf_CAST_TO_FLOAT(mask)))
 
-#if SIMD_LEVEL == FN_AVX512
+#if SIMD_LEVEL_AVX512
 
 #define MASK_OR(a,b) ((a)|(b))
 #define MASK_AND(a,b) ((a)&(b))
@@ -521,10 +714,42 @@ static float FUNC(INV_SQRT)(float x)
 
 #endif
 
-#if SIMD_LEVEL == FN_AVX512
+// Mask tests, true if all/any lanes are set
+#if SIMD_LEVEL_AVX512
+#define MASK_ALL(m) ((m) == 0xFFFF)
+#define MASK_ANY(m) ((m) != 0)
 #elif SIMD_LEVEL == FN_NEON
+#define MASK_ALL(m) ((vgetq_lane_s32(m,0) & vgetq_lane_s32(m,1) & vgetq_lane_s32(m,2) & vgetq_lane_s32(m,3)) != 0)
+#define MASK_ANY(m) ((vgetq_lane_s32(m,0) | vgetq_lane_s32(m,1) | vgetq_lane_s32(m,2) | vgetq_lane_s32(m,3)) != 0)
 #elif SIMD_LEVEL == FN_NO_SIMD_FALLBACK
+#define MASK_ALL(m) ((m) != 0)
+#define MASK_ANY(m) ((m) != 0)
+#elif SIMD_LEVEL == FN_PORTABLE
+static bool VECTORCALL FUNC(MASK_ALL)(SIMDi m)
+{
+	int all = -1;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		all &= m[i];
+	return all != 0;
+}
+
+static bool VECTORCALL FUNC(MASK_ANY)(SIMDi m)
+{
+	int any = 0;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+		any |= m[i];
+	return any != 0;
+}
+#define MASK_ALL(m) FUNC(MASK_ALL)(m)
+#define MASK_ANY(m) FUNC(MASK_ANY)(m)
+#else
+#if SIMD_LEVEL == FN_AVX2
+#define MASK_BITS(m) _mm256_movemask_ps(_mm256_castsi256_ps(m))
 #else
+#define MASK_BITS(m) _mm_movemask_ps(_mm_castsi128_ps(m))
+#endif
+#define MASK_ALL(m) (MASK_BITS(m) == (1 << VECTOR_SIZE) - 1)
+#define MASK_ANY(m) (MASK_BITS(m) != 0)
 #endif
 
 #if SIMD_LEVEL == FN_AVX2
@@ -539,7 +764,7 @@ static float FUNC(INV_SQRT)(float x)
 #define SIMDf_MUL_ADD(a,b,c) vmlaq_f32(b,c,a)
 #define SIMDf_MUL_SUB(a,b,c) SIMDf_SUB(SIMDf_MUL(a,b),c) // Neon multiply sub swaps sides of minus compared to FMA making it unusable
 #define SIMDf_NMUL_ADD(a,b,c) vmlaq_f32(b,c,a)
-#elif SIMD_LEVEL == FN_AVX512
+#elif SIMD_LEVEL_AVX512
 #define SIMDf_MUL_ADD(a,b,c) _mm512_fmadd_ps(a,b,c)
 #define SIMDf_MUL_SUB(a,b,c) _mm512_fmsub_ps(a,b,c)
 #define SIMDf_NMUL_ADD(a,b,c) _mm512_fnmadd_ps(a,b,c)
@@ -556,11 +781,35 @@ static float FUNC(INV_SQRT)(float x)
 #define SIMDf_NMUL_ADD(a,b,c)  SIMDf_SUB(c, SIMDf_MUL(a,b))
 #endif
 
+// floorA is SIMDf_FLOOR(a), levels that can convert a directly ignore it
+#ifndef SIMDi_CONVERT_FLOOR_TO_INT
+#define SIMDi_CONVERT_FLOOR_TO_INT(a,floorA) SIMDi_CONVERT_TO_INT(floorA)
+#endif
+
+// The inverse square root estimates differ between levels
+#ifdef FN_DETERMINISTIC
+#undef SIMDf_INV_SQRT
+#define SIMDf_INV_SQRT(a) SIMDf_DIV(SIMDf_NUM(1), SIMDf_SQRT(a))
+#endif
+
+// Levels reach a zero result through different instructions and disagree on its sign,
+// adding +0 turns -0 into +0 and leaves every other value as it is
+#ifdef FN_DETERMINISTIC
+#define SIMDf_POSITIVE_ZERO(a) SIMDf_ADD(a, SIMDf_NUM(0))
+#else
+#define SIMDf_POSITIVE_ZERO(a) (a)
+#endif
+
+#ifndef SIMDi_XOR3
+#define SIMDi_XOR3(a,b,c) SIMDi_XOR(SIMDi_XOR(a,b),c)
+#endif
+
 static bool VAR(SIMD_Values_Set) = false;
 
 static SIMDf SIMDf_NUM(incremental);
 static SIMDf SIMDf_NUM(0);
 static SIMDf SIMDf_NUM(2);
+static SIMDf SIMDf_NUM(3);
 static SIMDf SIMDf_NUM(6);
 static SIMDf SIMDf_NUM(10);
 static SIMDf SIMDf_NUM(15);
@@ -569,6 +818,8 @@ static SIMDf SIMDf_NUM(999999);
 
 static SIMDf SIMDf_NUM(0_5);
 static SIMDf SIMDf_NUM(0_6);
+static SIMDf SIMDf_NUM(1_01);
+static SIMDf SIMDf_NUM(0_0001);
 static SIMDf SIMDf_NUM(15_5);
 static SIMDf SIMDf_NUM(511_5);
 
@@ -580,7 +831,7 @@ static SIMDf SIMDf_NUM(hash2Float);
 static SIMDf SIMDf_NUM(vectorSize);
 static SIMDf SIMDf_NUM(cubicBounding);
 
-#if SIMD_LEVEL == FN_AVX512
+#if SIMD_LEVEL_AVX512
 static SIMDf SIMDf_NUM(X_GRAD);
 static SIMDf SIMDf_NUM(Y_GRAD);
 static SIMDf SIMDf_NUM(Z_GRAD);
@@ -627,6 +878,7 @@ void FUNC(InitSIMDValues)()
 	SIMDf_NUM(0) = SIMDf_SET_ZERO();
 	SIMDf_NUM(1) = SIMDf_SET(1.0f);
 	SIMDf_NUM(2) = SIMDf_SET(2.0f);
+	SIMDf_NUM(3) = SIMDf_SET(3.0f);
 	SIMDf_NUM(6) = SIMDf_SET(6.0f);
 	SIMDf_NUM(10) = SIMDf_SET(10.0f);
 	SIMDf_NUM(15) = SIMDf_SET(15.0f);
@@ -635,6 +887,8 @@ void FUNC(InitSIMDValues)()
 
 	SIMDf_NUM(0_5) = SIMDf_SET(0.5f);
 	SIMDf_NUM(0_6) = SIMDf_SET(0.6f);
+	SIMDf_NUM(1_01) = SIMDf_SET(1.01f);
+	SIMDf_NUM(0_0001) = SIMDf_SET(0.0001f);
 	SIMDf_NUM(15_5) = SIMDf_SET(15.5f);
 	SIMDf_NUM(511_5) = SIMDf_SET(511.5f);
 
@@ -646,7 +900,7 @@ void FUNC(InitSIMDValues)()
 	SIMDf_NUM(vectorSize) = SIMDf_SET(VECTOR_SIZE);
 	SIMDf_NUM(cubicBounding) = SIMDf_SET(1.f / (1.5f*1.5f*1.5f));
 
-#if SIMD_LEVEL == FN_AVX512
+#if SIMD_LEVEL_AVX512
 	SIMDf_NUM(X_GRAD) = _mm512_set_ps(0, -1, 0, 1, 0, 0, 0, 0, -1, 1, -1, 1, -1, 1, -1, 1);
 	SIMDf_NUM(Y_GRAD) = _mm512_set_ps(-1, 1, -1, 1, -1, 1, -1, 1, 0, 0, 0, 0, -1, -1, 1, 1);
 	SIMDf_NUM(Z_GRAD) = _mm512_set_ps(-1, 0, 1, 0, -1, -1, 1, 1, -1, -1, 1, 1, 0, 0, 0, 0);
@@ -705,24 +959,15 @@ static SIMDf VECTORCALL FUNC(CubicLerp)(SIMDf a, SIMDf b, SIMDf c, SIMDf d, SIMD
 	return SIMDf_MUL_ADD(t, SIMDf_MUL(t, SIMDf_MUL(t, p)), SIMDf_MUL_ADD(t, SIMDf_MUL(t, SIMDf_SUB(SIMDf_SUB(a, b), p)), SIMDf_MUL_ADD(t, SIMDf_SUB(c, a), b)));
 }
 
-//static SIMDf VECTORCALL FUNC(InterpHermite)(SIMDf t)
-//{
-//	SIMDf r;
-//	r = SIMDf_MUL(t, SIMDf_NUM(2));
-//	r = SIMDf_SUB(SIMDf_ADD(SIMDf_NUM(1), SIMDf_NUM(2)), r);
-//	r = SIMDf_MUL(r, t);
-//	r = SIMDf_MUL(r, t);
-//
-//	return r;
-//}
+// Fast precision interpolation, see SetPrecision()
+static SIMDf VECTORCALL FUNC(InterpHermite)(SIMDf t)
+{
+	return SIMDf_MUL(SIMDf_MUL(t, t), SIMDf_SUB(SIMDf_NUM(3), SIMDf_ADD(t, t)));
+}
 
 static SIMDi VECTORCALL FUNC(Hash)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 {
-	SIMDi hash = seed;
-
-	hash = SIMDi_XOR(x, hash);
-	hash = SIMDi_XOR(y, hash);
-	hash = SIMDi_XOR(z, hash);
+	SIMDi hash = SIMDi_XOR(SIMDi_XOR3(seed, x, y), z);
 
 	hash = SIMDi_MUL(SIMDi_MUL(SIMDi_MUL(hash, hash), SIMDi_NUM(60493)), hash);
 	hash = SIMDi_XOR(SIMDi_SHIFT_R(hash, 13), hash);
@@ -732,11 +977,7 @@ static SIMDi VECTORCALL FUNC(Hash)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 
 static SIMDi VECTORCALL FUNC(HashHB)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 {
-	SIMDi hash = seed;
-
-	hash = SIMDi_XOR(x, hash);
-	hash = SIMDi_XOR(y, hash);
-	hash = SIMDi_XOR(z, hash);
+	SIMDi hash = SIMDi_XOR(SIMDi_XOR3(seed, x, y), z);
 	//hash = SIMDi_XOR(SIMDi_SHIFT_R(hash, 13), hash);
 
 	hash = SIMDi_MUL(SIMDi_MUL(SIMDi_MUL(hash, hash), SIMDi_NUM(60493)), hash);
@@ -747,11 +988,7 @@ static SIMDi VECTORCALL FUNC(HashHB)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 static SIMDf VECTORCALL FUNC(ValCoord)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 {
 	// High bit hash
-	SIMDi hash = seed;
-
-	hash = SIMDi_XOR(x, hash);
-	hash = SIMDi_XOR(y, hash);
-	hash = SIMDi_XOR(z, hash);
+	SIMDi hash = SIMDi_XOR(SIMDi_XOR3(seed, x, y), z);
 
 	hash = SIMDi_MUL(SIMDi_MUL(SIMDi_MUL(hash, hash), SIMDi_NUM(60493)), hash);
 	//hash = SIMDi_XOR(SIMDi_SHIFT_L(hash, 13), hash);
@@ -759,11 +996,9 @@ static SIMDf VECTORCALL FUNC(ValCoord)(SIMDi seed, SIMDi x, SIMDi y, SIMDi z)
 	return SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(hash));
 }
 
-#if SIMD_LEVEL == FN_AVX512
-static SIMDf VECTORCALL FUNC(GradCoord)(SIMDi seed, SIMDi xi, SIMDi yi, SIMDi zi, SIMDf x, SIMDf y, SIMDf z)
+#if SIMD_LEVEL_AVX512
+static SIMDf VECTORCALL FUNC(GradCoordHash)(SIMDi hash, SIMDf x, SIMDf y, SIMDf z)
 {
-	SIMDi hash = FUNC(Hash)(seed, xi, yi, zi);
-
 	SIMDf xGrad = SIMDf_PERMUTE(SIMDf_NUM(X_GRAD), hash);
 	SIMDf yGrad = SIMDf_PERMUTE(SIMDf_NUM(Y_GRAD), hash);
 	SIMDf zGrad = SIMDf_PERMUTE(SIMDf_NUM(Z_GRAD), hash);
@@ -771,9 +1006,8 @@ static SIMDf VECTORCALL FUNC(GradCoord)(SIMDi seed, SIMDi xi, SIMDi yi, SIMDi zi
 	return SIMDf_MUL_ADD(x, xGrad, SIMDf_MUL_ADD(y, yGrad, SIMDf_MUL(z, zGrad)));
 }
 #else
-static SIMDf VECTORCALL FUNC(GradCoord)(SIMDi seed, SIMDi xi, SIMDi yi, SIMDi zi, SIMDf x, SIMDf y, SIMDf z)
+static SIMDf VECTORCALL FUNC(GradCoordHash)(SIMDi hash, SIMDf x, SIMDf y, SIMDf z)
 {
-	SIMDi hash = FUNC(Hash)(seed, xi, yi, zi);
 	SIMDi hasha13 = SIMDi_AND(hash, SIMDi_NUM(13));
 
 	//if h < 8 then x, else y
@@ -794,6 +1028,111 @@ static SIMDf VECTORCALL FUNC(GradCoord)(SIMDi seed, SIMDi xi, SIMDi yi, SIMDi zi
 }
 #endif
 
+static SIMDf VECTORCALL FUNC(GradCoord)(SIMDi seed, SIMDi xi, SIMDi yi, SIMDi zi, SIMDf x, SIMDf y, SIMDf z)
+{
+	return FUNC(GradCoordHash)(FUNC(Hash)(seed, xi, yi, zi), x, y, z);
+}
+
+// Corner hashes of the last lattice cell a whole vector fell into
+// Along a set row at usual frequencies most vectors stay in the same cell as the one before
+struct LatticeCellCache
+{
+	static const int SAMPLE_LOOKUPS = 64;
+
+	bool filled;
+	bool bypass;
+	int lookups;
+	int hits;
+	int seed;
+	int x;
+	int y;
+	int z;
+	int hash[8];
+};
+
+// One cache per seed, fractal octaves use consecutive seeds
+#define SEED_CACHE_SLOTS 8
+
+#define LATTICE_CACHE_INIT(_cache)\
+LatticeCellCache _cache[SEED_CACHE_SLOTS];\
+for (int _i = 0; _i < SEED_CACHE_SLOTS; _i++) { _cache[_i].filled = false; _cache[_i].bypass = false; _cache[_i].lookups = 0; _cache[_i].hits = 0; }
+
+static int VECTORCALL FUNC(FirstLane)(SIMDi a)
+{
+	uSIMDi u;
+	u.m = a;
+	return u.a[0];
+}
+
+// Returns the cache slot for this seed if every lane is in the same cell, otherwise nullptr
+// hit is set if the slot already holds this cell, on a miss the caller must fill all 8 hashes
+// A seed whose first lookups mostly miss stops using the cache for the rest of the fill,
+// at high frequencies vectors straddle cells and the check would only add cost
+static LatticeCellCache* VECTORCALL FUNC(LatticeCellLookup)(LatticeCellCache* caches, SIMDi seed, SIMDi x0, SIMDi y0, SIMDi z0, bool& hit)
+{
+	hit = false;
+	int seedKey = FUNC(FirstLane)(seed);
+	LatticeCellCache* cell = &caches[seedKey & (SEED_CACHE_SLOTS - 1)];
+
+	if (cell->bypass)
+		return nullptr;
+
+	if (++cell->lookups == LatticeCellCache::SAMPLE_LOOKUPS)
+		cell->bypass = cell->hits * 2 < LatticeCellCache::SAMPLE_LOOKUPS;
+
+	int x = FUNC(FirstLane)(x0);
+	int y = FUNC(FirstLane)(y0);
+	int z = FUNC(FirstLane)(z0);
+
+	if (!MASK_ALL(MASK_AND(SIMDi_EQUAL(x0, SIMDi_SET(x)), MASK_AND(SIMDi_EQUAL(y0, SIMDi_SET(y)), SIMDi_EQUAL(z0, SIMDi_SET(z))))))
+		return nullptr;
+
+	if (cell->filled && cell->seed == seedKey && cell->x == x && cell->y == y && cell->z == z)
+	{
+		cell->hits++;
+		hit = true;
+		return cell;
+	}
+
+	cell->filled = true;
+	cell->seed = seedKey;
+	cell->x = x;
+	cell->y = y;
+	cell->z = z;
+	return cell;
+}
+
+#define LATTICE_CELL_HASH_LOAD(_x, _y, _z) hash##_x##_y##_z = SIMDi_SET(cell->hash[_x * 4 + _y * 2 + _z])
+#define LATTICE_CELL_HASH_STORE(_x, _y, _z) cell->hash[_x * 4 + _y * 2 + _z] = FUNC(FirstLane)(hash##_x##_y##_z)
+#define LATTICE_CELL_HASH_EACH(_action)\
+_action(0, 0, 0); _action(0, 0, 1); _action(0, 1, 0); _action(0, 1, 1);\
+_action(1, 0, 0); _action(1, 0, 1); _action(1, 1, 0); _action(1, 1, 1)
+
+// Declares hash000 to hash111 for the cell at x0, y0, z0
+#define LATTICE_CELL_HASHES(_hashFunc)\
+SIMDi hash000, hash001, hash010, hash011, hash100, hash101, hash110, hash111;\
+bool cellHit;\
+LatticeCellCache* cell = FUNC(LatticeCellLookup)(caches, seed, x0, y0, z0, cellHit);\
+if (cellHit)\
+{\
+	LATTICE_CELL_HASH_EACH(LATTICE_CELL_HASH_LOAD);\
+}\
+else\
+{\
+	hash000 = FUNC(_hashFunc)(seed, x0, y0, z0);\
+	hash001 = FUNC(_hashFunc)(seed, x0, y0, z1);\
+	hash010 = FUNC(_hashFunc)(seed, x0, y1, z0);\
+	hash011 = FUNC(_hashFunc)(seed, x0, y1, z1);\
+	hash100 = FUNC(_hashFunc)(seed, x1, y0, z0);\
+	hash101 = FUNC(_hashFunc)(seed, x1, y0, z1);\
+	hash110 = FUNC(_hashFunc)(seed, x1, y1, z0);\
+	hash111 = FUNC(_hashFunc)(seed, x1, y1, z1);\
+	if (cell)\
+	{\
+		LATTICE_CELL_HASH_EACH(LATTICE_CELL_HASH_STORE);\
+	}\
+}
+
 static SIMDf VECTORCALL FUNC(WhiteNoiseSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 {
 	return FUNC(ValCoord)(seed,
@@ -808,9 +1147,9 @@ static SIMDf VECTORCALL FUNC(ValueSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 	SIMDf ys = SIMDf_FLOOR(y);
 	SIMDf zs = SIMDf_FLOOR(z);
 
-	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(xs), SIMDi_NUM(xPrime));
-	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(ys), SIMDi_NUM(yPrime));
-	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(zs), SIMDi_NUM(zPrime));
+	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xs), SIMDi_NUM(xPrime));
+	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, ys), SIMDi_NUM(yPrime));
+	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(z, zs), SIMDi_NUM(zPrime));
 	SIMDi x1 = SIMDi_ADD(x0, SIMDi_NUM(xPrime));
 	SIMDi y1 = SIMDi_ADD(y0, SIMDi_NUM(yPrime));
 	SIMDi z1 = SIMDi_ADD(z0, SIMDi_NUM(zPrime));
@@ -828,15 +1167,24 @@ static SIMDf VECTORCALL FUNC(ValueSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 			FUNC(Lerp)(FUNC(ValCoord)(seed, x0, y1, z1), FUNC(ValCoord)(seed, x1, y1, z1), xs), ys), zs);
 }
 
+// ValueSingle on integer coordinates, the interpolation weights are all 0 so only the x0, y0, z0 corner is left
+static SIMDf VECTORCALL FUNC(ValueLatticeSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
+{
+	return FUNC(ValCoord)(seed,
+		SIMDi_MUL(SIMDi_CONVERT_TO_INT(x), SIMDi_NUM(xPrime)),
+		SIMDi_MUL(SIMDi_CONVERT_TO_INT(y), SIMDi_NUM(yPrime)),
+		SIMDi_MUL(SIMDi_CONVERT_TO_INT(z), SIMDi_NUM(zPrime)));
+}
+
 static SIMDf VECTORCALL FUNC(PerlinSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 {
 	SIMDf xs = SIMDf_FLOOR(x);
 	SIMDf ys = SIMDf_FLOOR(y);
 	SIMDf zs = SIMDf_FLOOR(z);
 
-	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(xs), SIMDi_NUM(xPrime));
-	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(ys), SIMDi_NUM(yPrime));
-	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(zs), SIMDi_NUM(zPrime));
+	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xs), SIMDi_NUM(xPrime));
+	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, ys), SIMDi_NUM(yPrime));
+	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(z, zs), SIMDi_NUM(zPrime));
 	SIMDi x1 = SIMDi_ADD(x0, SIMDi_NUM(xPrime));
 	SIMDi y1 = SIMDi_ADD(y0, SIMDi_NUM(yPrime));
 	SIMDi z1 = SIMDi_ADD(z0, SIMDi_NUM(zPrime));
@@ -861,6 +1209,81 @@ static SIMDf VECTORCALL FUNC(PerlinSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z
 			FUNC(Lerp)(FUNC(GradCoord)(seed, x0, y1, z1, xf0, yf1, zf1), FUNC(GradCoord)(seed, x1, y1, z1, xf1, yf1, zf1), xs), ys), zs);
 }
 
+#define VALUE_COORD_HASH(_hash) SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(_hash))
+
+// Same result as ValueSingle, skipping the corner hashes when the whole vector is in the last cell seen for this seed
+// _interp is InterpQuintic, or InterpHermite for Fast precision
+#define VALUE_CACHED_SINGLE(_name, _interp)\
+static SIMDf VECTORCALL FUNC(_name)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, LatticeCellCache* caches)\
+{\
+	SIMDf xs = SIMDf_FLOOR(x);\
+	SIMDf ys = SIMDf_FLOOR(y);\
+	SIMDf zs = SIMDf_FLOOR(z);\
+	\
+	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xs), SIMDi_NUM(xPrime));\
+	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, ys), SIMDi_NUM(yPrime));\
+	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(z, zs), SIMDi_NUM(zPrime));\
+	SIMDi x1 = SIMDi_ADD(x0, SIMDi_NUM(xPrime));\
+	SIMDi y1 = SIMDi_ADD(y0, SIMDi_NUM(yPrime));\
+	SIMDi z1 = SIMDi_ADD(z0, SIMDi_NUM(zPrime));\
+	\
+	LATTICE_CELL_HASHES(HashHB);\
+	\
+	xs = FUNC(_interp)(SIMDf_SUB(x, xs));\
+	ys = FUNC(_interp)(SIMDf_SUB(y, ys));\
+	zs = FUNC(_interp)(SIMDf_SUB(z, zs));\
+	\
+	return FUNC(Lerp)(\
+		FUNC(Lerp)(\
+			FUNC(Lerp)(VALUE_COORD_HASH(hash000), VALUE_COORD_HASH(hash100), xs),\
+			FUNC(Lerp)(VALUE_COORD_HASH(hash010), VALUE_COORD_HASH(hash110), xs), ys),\
+		FUNC(Lerp)(\
+			FUNC(Lerp)(VALUE_COORD_HASH(hash001), VALUE_COORD_HASH(hash101), xs),\
+			FUNC(Lerp)(VALUE_COORD_HASH(hash011), VALUE_COORD_HASH(hash111), xs), ys), zs);\
+}
+
+// Same result as PerlinSingle, see VALUE_CACHED_SINGLE
+#define PERLIN_CACHED_SINGLE(_name, _interp)\
+static SIMDf VECTORCALL FUNC(_name)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, LatticeCellCache* caches)\
+{\
+	SIMDf xs = SIMDf_FLOOR(x);\
+	SIMDf ys = SIMDf_FLOOR(y);\
+	SIMDf zs = SIMDf_FLOOR(z);\
+	\
+	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xs), SIMDi_NUM(xPrime));\
+	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, ys), SIMDi_NUM(yPrime));\
+	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(z, zs), SIMDi_NUM(zPrime));\
+	SIMDi x1 = SIMDi_ADD(x0, SIMDi_NUM(xPrime));\
+	SIMDi y1 = SIMDi_ADD(y0, SIMDi_NUM(yPrime));\
+	SIMDi z1 = SIMDi_ADD(z0, SIMDi_NUM(zPrime));\
+	\
+	LATTICE_CELL_HASHES(Hash);\
+	\
+	SIMDf xf0 = xs = SIMDf_SUB(x, xs);\
+	SIMDf yf0 = ys = SIMDf_SUB(y, ys);\
+	SIMDf zf0 = zs = SIMDf_SUB(z, zs);\
+	SIMDf xf1 = SIMDf_SUB(xf0, SIMDf_NUM(1));\
+	SIMDf yf1 = SIMDf_SUB(yf0, SIMDf_NUM(1));\
+	SIMDf zf1 = SIMDf_SUB(zf0, SIMDf_NUM(1));\
+	\
+	xs = FUNC(_interp)(xs);\
+	ys = FUNC(_interp)(ys);\
+	zs = FUNC(_interp)(zs);\
+	\
+	return FUNC(Lerp)(\
+		FUNC(Lerp)(\
+			FUNC(Lerp)(FUNC(GradCoordHash)(hash000, xf0, yf0, zf0), FUNC(GradCoordHash)(hash100, xf1, yf0, zf0), xs),\
+			FUNC(Lerp)(FUNC(GradCoordHash)(hash010, xf0, yf1, zf0), FUNC(GradCoordHash)(hash110, xf1, yf1, zf0), xs), ys),\
+		FUNC(Lerp)(\
+			FUNC(Lerp)(FUNC(GradCoordHash)(hash001, xf0, yf0, zf1), FUNC(GradCoordHash)(hash101, xf1, yf0, zf1), xs),\
+			FUNC(Lerp)(FUNC(GradCoordHash)(hash011, xf0, yf1, zf1), FUNC(GradCoordHash)(hash111, xf1, yf1, zf1), xs), ys), zs);\
+}
+
+VALUE_CACHED_SINGLE(ValueCachedSingle, InterpQuintic)
+VALUE_CACHED_SINGLE(ValueFastCachedSingle, InterpHermite)
+PERLIN_CACHED_SINGLE(PerlinCachedSingle, InterpQuintic)
+PERLIN_CACHED_SINGLE(PerlinFastCachedSingle, InterpHermite)
+
 static SIMDf VECTORCALL FUNC(SimplexSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 {
 	SIMDf f = SIMDf_MUL(SIMDf_NUM(F3), SIMDf_ADD(SIMDf_ADD(x, y), z));
@@ -928,9 +1351,9 @@ static SIMDf VECTORCALL FUNC(CubicSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 	SIMDf yf1 = SIMDf_FLOOR(y);
 	SIMDf zf1 = SIMDf_FLOOR(z);
 
-	SIMDi x1 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(xf1), SIMDi_NUM(xPrime));
-	SIMDi y1 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(yf1), SIMDi_NUM(yPrime));
-	SIMDi z1 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(zf1), SIMDi_NUM(zPrime));
+	SIMDi x1 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xf1), SIMDi_NUM(xPrime));
+	SIMDi y1 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, yf1), SIMDi_NUM(yPrime));
+	SIMDi z1 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(z, zf1), SIMDi_NUM(zPrime));
 
 	SIMDi x0 = SIMDi_SUB(x1, SIMDi_NUM(xPrime));
 	SIMDi y0 = SIMDi_SUB(y1, SIMDi_NUM(yPrime));
@@ -974,8 +1397,112 @@ static SIMDf VECTORCALL FUNC(CubicSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
 		zs), SIMDf_NUM(cubicBounding));
 }
 
+// CubicSingle on integer coordinates, CubicLerp with t = 0 returns b so only the x1, y1, z1 corner is left
+static SIMDf VECTORCALL FUNC(CubicLatticeSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z)
+{
+	return SIMDf_MUL(FUNC(ValueLatticeSingle)(seed, x, y, z), SIMDf_NUM(cubicBounding));
+}
+
+// Lattice values along z for one row of a set, already interpolated along x and y
+// Vectors in the same row share x and y, so only the final interpolation along z differs between them
+struct CubicColumnCache
+{
+	static const int SIZE = VECTOR_SIZE * 4;
+
+	int seed;
+	int xKey;
+	int yKey;
+	int zBase;
+	int count;
+	float column[SIZE];
+};
+
+#define CUBIC_CACHE_INIT(_cache)\
+CubicColumnCache _cache[SEED_CACHE_SLOTS];\
+for (int _i = 0; _i < SEED_CACHE_SLOTS; _i++) { _cache[_i].seed = 0; _cache[_i].xKey = 0; _cache[_i].yKey = 0; _cache[_i].zBase = 0; _cache[_i].count = 0; }
+
+#define CUBIC_COLUMN(_z) FUNC(CubicLerp)(\
+	FUNC(CubicLerp)(FUNC(ValCoord)(seed, x0, y0, _z), FUNC(ValCoord)(seed, x1, y0, _z), FUNC(ValCoord)(seed, x2, y0, _z), FUNC(ValCoord)(seed, x3, y0, _z), xs),\
+	FUNC(CubicLerp)(FUNC(ValCoord)(seed, x0, y1, _z), FUNC(ValCoord)(seed, x1, y1, _z), FUNC(ValCoord)(seed, x2, y1, _z), FUNC(ValCoord)(seed, x3, y1, _z), xs),\
+	FUNC(CubicLerp)(FUNC(ValCoord)(seed, x0, y2, _z), FUNC(ValCoord)(seed, x1, y2, _z), FUNC(ValCoord)(seed, x2, y2, _z), FUNC(ValCoord)(seed, x3, y2, _z), xs),\
+	FUNC(CubicLerp)(FUNC(ValCoord)(seed, x0, y3, _z), FUNC(ValCoord)(seed, x1, y3, _z), FUNC(ValCoord)(seed, x2, y3, _z), FUNC(ValCoord)(seed, x3, y3, _z), xs),\
+	ys)
+
+// Same result as CubicSingle, but reuses the x/y interpolated lattice columns between vectors in a row
+// Vectors that don't share x and y across lanes (perturb, row crossings) or span too many cells fall back to CubicSingle
+static SIMDf VECTORCALL FUNC(CubicCachedSingle)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, CubicColumnCache* caches)
+{
+	uSIMDi xKey, yKey;
+	xKey.m = SIMDi_CAST_TO_INT(x);
+	yKey.m = SIMDi_CAST_TO_INT(y);
+
+	if (!MASK_ALL(MASK_AND(SIMDi_EQUAL(xKey.m, SIMDi_SET(xKey.a[0])), SIMDi_EQUAL(yKey.m, SIMDi_SET(yKey.a[0])))))
+		return FUNC(CubicSingle)(seed, x, y, z);
+
+	SIMDf zf1 = SIMDf_FLOOR(z);
+	uSIMDi zCell;
+	zCell.m = SIMDi_CONVERT_FLOOR_TO_INT(z, zf1);
+
+	int zMin = zCell.a[0];
+	int zMax = zCell.a[0];
+	for (int i = 1; i < VECTOR_SIZE; i++)
+	{
+		zMin = std::min(zMin, zCell.a[i]);
+		zMax = std::max(zMax, zCell.a[i]);
+	}
+
+	if (zMax - zMin + 4 > CubicColumnCache::SIZE)
+		return FUNC(CubicSingle)(seed, x, y, z);
+
+	int seedKey = FUNC(FirstLane)(seed);
+	CubicColumnCache& cache = caches[seedKey & (SEED_CACHE_SLOTS - 1)];
+
+	if (cache.seed != seedKey || cache.xKey != xKey.a[0] || cache.yKey != yKey.a[0] ||
+		zMin - 1 < cache.zBase || zMax + 3 > cache.zBase + cache.count)
+	{
+		SIMDf xf1 = SIMDf_FLOOR(x);
+		SIMDf yf1 = SIMDf_FLOOR(y);
+
+		SIMDi x1 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(x, xf1), SIMDi_NUM(xPrime));
+		SIMDi y1 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(y, yf1), SIMDi_NUM(yPrime));
+
+		SIMDi x0 = SIMDi_SUB(x1, SIMDi_NUM(xPrime));
+		SIMDi y0 = SIMDi_SUB(y1, SIMDi_NUM(yPrime));
+		SIMDi x2 = SIMDi_ADD(x1, SIMDi_NUM(xPrime));
+		SIMDi y2 = SIMDi_ADD(y1, SIMDi_NUM(yPrime));
+		SIMDi x3 = SIMDi_ADD(x2, SIMDi_NUM(xPrime));
+		SIMDi y3 = SIMDi_ADD(y2, SIMDi_NUM(yPrime));
+
+		SIMDf xs = SIMDf_SUB(x, xf1);
+		SIMDf ys = SIMDf_SUB(y, yf1);
+
+		cache.seed = seedKey;
+		cache.xKey = xKey.a[0];
+		cache.yKey = yKey.a[0];
+		cache.zBase = zMin - 1;
+		cache.count = (zMax - zMin + 4 + VECTOR_SIZE - 1) & ~(VECTOR_SIZE - 1);
+
+		for (int c = 0; c < cache.count; c += VECTOR_SIZE)
+		{
+			SIMDi zc = SIMDi_MUL(SIMDi_ADD(SIMDi_SET(cache.zBase + c), SIMDi_NUM(incremental)), SIMDi_NUM(zPrime));
+			SIMDf_STORE_UNALIGNED(&cache.column[c], CUBIC_COLUMN(zc));
+		}
+	}
+
+	uSIMDf c0, c1, c2, c3;
+	for (int i = 0; i < VECTOR_SIZE; i++)
+	{
+		const float* column = &cache.column[zCell.a[i] - 1 - cache.zBase];
+		c0.a[i] = column[0];
+		c1.a[i] = column[1];
+		c2.a[i] = column[2];
+		c3.a[i] = column[3];
+	}
+
+	return SIMDf_MUL(FUNC(CubicLerp)(c0.m, c1.m, c2.m, c3.m, SIMDf_SUB(z, zf1)), SIMDf_NUM(cubicBounding));
+}
+
 #define GRADIENT_COORD(_x,_y,_z)\
-SIMDi hash##_x##_y##_z = FUNC(HashHB)(seed, x##_x, y##_y, z##_z); \
 SIMDf x##_x##_y##_z = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash##_x##_y##_z, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5)); \
 SIMDf y##_x##_y##_z = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash##_x##_y##_z, 10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5)); \
 SIMDf z##_x##_y##_z = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash##_x##_y##_z, 20), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5)); 
@@ -985,7 +1512,7 @@ SIMDf z##_x##_y##_z = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(h
 //y##_x##_y##_z = SIMDf_MUL(y##_x##_y##_z, invMag##_x##_y##_z); 
 //z##_x##_y##_z = SIMDf_MUL(z##_x##_y##_z, invMag##_x##_y##_z);
 
-static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency, SIMDf& x, SIMDf& y, SIMDf& z)
+static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency, SIMDf& x, SIMDf& y, SIMDf& z, LatticeCellCache* caches)
 {
 	SIMDf xf = SIMDf_MUL(x, perturbFrequency);
 	SIMDf yf = SIMDf_MUL(y, perturbFrequency);
@@ -995,9 +1522,9 @@ static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp,
 	SIMDf ys = SIMDf_FLOOR(yf);
 	SIMDf zs = SIMDf_FLOOR(zf);
 
-	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(xs), SIMDi_NUM(xPrime));
-	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(ys), SIMDi_NUM(yPrime));
-	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_TO_INT(zs), SIMDi_NUM(zPrime));
+	SIMDi x0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(xf, xs), SIMDi_NUM(xPrime));
+	SIMDi y0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(yf, ys), SIMDi_NUM(yPrime));
+	SIMDi z0 = SIMDi_MUL(SIMDi_CONVERT_FLOOR_TO_INT(zf, zs), SIMDi_NUM(zPrime));
 	SIMDi x1 = SIMDi_ADD(x0, SIMDi_NUM(xPrime));
 	SIMDi y1 = SIMDi_ADD(y0, SIMDi_NUM(yPrime));
 	SIMDi z1 = SIMDi_ADD(z0, SIMDi_NUM(zPrime));
@@ -1006,6 +1533,8 @@ static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp,
 	ys = FUNC(InterpQuintic)(SIMDf_SUB(yf, ys));
 	zs = FUNC(InterpQuintic)(SIMDf_SUB(zf, zs));
 
+	LATTICE_CELL_HASHES(HashHB);
+
 	GRADIENT_COORD(0, 0, 0);
 	GRADIENT_COORD(0, 0, 1);
 	GRADIENT_COORD(0, 1, 0);
@@ -1028,56 +1557,232 @@ static void VECTORCALL FUNC(GradientPerturbSingle)(SIMDi seed, SIMDf perturbAmp,
 	z = SIMDf_MUL_ADD(FUNC(Lerp)(z0y, z1y, zs), perturbAmp, z);
 }
 
+// Scales the coordinate to the normalise length, a coordinate at the origin has no direction and stays there
+static void VECTORCALL FUNC(PerturbNormalise)(SIMDf perturbNormaliseLength, SIMDf& x, SIMDf& y, SIMDf& z)
+{
+	SIMDf lengthSq = SIMDf_MUL_ADD(x, x, SIMDf_MUL_ADD(y, y, SIMDf_MUL(z, z)));
+	SIMDf invMag = SIMDf_BLENDV(SIMDf_NUM(1), SIMDf_MUL(perturbNormaliseLength, SIMDf_INV_SQRT(lengthSq)), SIMDf_GREATER_THAN(lengthSq, SIMDf_NUM(0)));
+
+	x = SIMDf_MUL(x, invMag);
+	y = SIMDf_MUL(y, invMag);
+	z = SIMDf_MUL(z, invMag);
+}
+
+#ifdef SIMPLEX_ENABLED
+// Perturb with a simplex noise per axis, scaled to the range of the lattice gradient offsets
+static void VECTORCALL FUNC(SimplexPerturbSingle)(SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency, SIMDf& x, SIMDf& y, SIMDf& z)
+{
+	SIMDf xf = SIMDf_MUL(x, perturbFrequency);
+	SIMDf yf = SIMDf_MUL(y, perturbFrequency);
+	SIMDf zf = SIMDf_MUL(z, perturbFrequency);
+
+	SIMDf ampF = SIMDf_MUL(perturbAmp, SIMDf_NUM(511_5));
+
+	SIMDf xOffset = FUNC(SimplexSingle)(seed, xf, yf, zf);
+	SIMDf yOffset = FUNC(SimplexSingle)(SIMDi_ADD(seed, SIMDi_NUM(xPrime)), xf, yf, zf);
+	SIMDf zOffset = FUNC(SimplexSingle)(SIMDi_ADD(seed, SIMDi_NUM(yPrime)), xf, yf, zf);
+
+	x = SIMDf_MUL_ADD(xOffset, ampF, x);
+	y = SIMDf_MUL_ADD(yOffset, ampF, y);
+	z = SIMDf_MUL_ADD(zOffset, ampF, z);
+}
+
+// Kept out of line so the simplex kernel doesn't grow every inlined perturb switch
+static NOINLINE void VECTORCALL FUNC(SimplexPerturb)(int perturbType, int perturbOctaves, SIMDi seed, SIMDf perturbAmp, SIMDf perturbFrequency,
+	const SIMDf& perturbLacunarity, const SIMDf& perturbGain, const SIMDf& perturbNormaliseLength, SIMDf& x, SIMDf& y, SIMDf& z)
+{
+	FUNC(SimplexPerturbSingle)(seed, perturbAmp, perturbFrequency, x, y, z);
+
+	if (perturbType == _FastNoiseSIMD::GradientFractal || perturbType == _FastNoiseSIMD::GradientFractal_Normalise)
+	{
+		for (int octaveIndex = 1; octaveIndex < perturbOctaves; octaveIndex++)
+		{
+			perturbFrequency = SIMDf_MUL(perturbFrequency, perturbLacunarity);
+			seed = SIMDi_SUB(seed, SIMDi_NUM(1));
+			perturbAmp = SIMDf_MUL(perturbAmp, perturbGain);
+
+			FUNC(SimplexPerturbSingle)(seed, perturbAmp, perturbFrequency, x, y, z);
+		}
+	}
+
+	if (perturbType == _FastNoiseSIMD::Gradient_Normalise || perturbType == _FastNoiseSIMD::GradientFractal_Normalise)
+		FUNC(PerturbNormalise)(perturbNormaliseLength, x, y, z);
+}
+#endif
+
 SIMD_LEVEL_CLASS::FASTNOISE_SIMD_CLASS(SIMD_LEVEL)(int seed)
 {
 	m_seed = seed;
 	m_fractalBounding = CalculateFractalBounding(m_octaves, m_gain);
 	m_perturbFractalBounding = CalculateFractalBounding(m_perturbOctaves, m_perturbGain);
 	FUNC(InitSIMDValues)();
-	s_currentSIMDLevel = SIMD_LEVEL;
+	m_SIMDLevel = SIMD_LEVEL;
+	m_vectorSize = VECTOR_SIZE;
 }
 
-int SIMD_LEVEL_CLASS::AlignedSize(int size)
+int SIMD_LEVEL_CLASS::VectorSize()
 {
-#ifdef FN_ALIGNED_SETS
-	// size must be a multiple of VECTOR_SIZE (8)
-	if ((size & (VECTOR_SIZE - 1)) != 0)
-	{
-		size &= ~(VECTOR_SIZE - 1);
-		size += VECTOR_SIZE;
-	}
-#endif
-	return size;
+	return VECTOR_SIZE;
 }
 
-float* SIMD_LEVEL_CLASS::GetEmptySet(int size)
+void SIMD_LEVEL_CLASS::ConvertToHalf(uint16_t* halfSet, const float* floatSet, int size)
 {
-	size = AlignedSize(size);
+	int index = 0;
 
-	float* noiseSet;
-	SIMD_ALLOCATE_SET(noiseSet, size);
+#if SIMD_LEVEL_AVX512
+	for (; index <= size - VECTOR_SIZE; index += VECTOR_SIZE)
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(halfSet + index), _mm512_cvtps_ph(SIMDf_LOAD_UNALIGNED(floatSet + index), _MM_FROUND_TO_NEAREST_INT));
+#elif SIMD_LEVEL == FN_AVX2
+	// F16C, every AVX2 CPU has it
+	for (; index <= size - VECTOR_SIZE; index += VECTOR_SIZE)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(halfSet + index), _mm256_cvtps_ph(SIMDf_LOAD_UNALIGNED(floatSet + index), _MM_FROUND_TO_NEAREST_INT));
+#endif
 
-	return noiseSet;
+	for (; index < size; index++)
+		halfSet[index] = FloatToHalf(floatSet[index]);
 }
 
-#define AXIS_RESET(_zSize, _start) for (int _i = (_zSize) * (_start); _i < VECTOR_SIZE; _i+=(_zSize)){\
-MASK _zReset = SIMDi_GREATER_THAN(z, zEndV);\
-y = SIMDi_MASK_ADD(_zReset, y, SIMDi_NUM(1));\
-z = SIMDi_MASK_SUB(_zReset, z, zSizeV);\
-\
-MASK _yReset = SIMDi_GREATER_THAN(y, yEndV);\
-x = SIMDi_MASK_ADD(_yReset, x, SIMDi_NUM(1));\
-y = SIMDi_MASK_SUB(_yReset, y, ySizeV);}
+void SIMD_LEVEL_CLASS::ConvertToHeights(float* heightSet, const float* floatSet, int size, float heightScale, float heightBias, float& minOut, float& maxOut)
+{
+	int index = 0;
 
-#ifdef FN_ALIGNED_SETS
-#define STORE_LAST_RESULT(_dest, _source) SIMDf_STORE(_dest, _source)
-#else
-#include <cstring>
-#define STORE_LAST_RESULT(_dest, _source) std::memcpy(_dest, &_source, (maxIndex - index) * 4)
-#endif
+	if (size >= VECTOR_SIZE)
+	{
+		SIMDf heightScaleV = SIMDf_SET(heightScale);
+		SIMDf heightBiasV = SIMDf_SET(heightBias);
+		SIMDf minV = SIMDf_SET(minOut);
+		SIMDf maxV = SIMDf_SET(maxOut);
 
-#define INIT_PERTURB_VALUES() \
+		for (; index <= size - VECTOR_SIZE; index += VECTOR_SIZE)
+		{
+			SIMDf height = SIMDf_MUL_ADD(SIMDf_LOAD_UNALIGNED(&floatSet[index]), heightScaleV, heightBiasV);
+			minV = SIMDf_MIN(minV, height);
+			maxV = SIMDf_MAX(maxV, height);
+			SIMDf_STORE_UNALIGNED(&heightSet[index], height);
+		}
+
+		float minLanes[VECTOR_SIZE];
+		float maxLanes[VECTOR_SIZE];
+		std::memcpy(minLanes, &minV, sizeof(SIMDf));
+		std::memcpy(maxLanes, &maxV, sizeof(SIMDf));
+
+		for (int i = 0; i < VECTOR_SIZE; i++)
+		{
+			minOut = std::min(minOut, minLanes[i]);
+			maxOut = std::max(maxOut, maxLanes[i]);
+		}
+	}
+
+	for (; index < size; index++)
+	{
+		float height = floatSet[index] * heightScale + heightBias;
+		minOut = std::min(minOut, height);
+		maxOut = std::max(maxOut, height);
+		heightSet[index] = height;
+	}
+}
+
+// Maps a normal component from [-1, 1] to [0, 255], clamped as the approximate inverse square root can overshoot
+static uint8_t FUNC(NormalToByte)(float component)
+{
+	return static_cast<uint8_t>(std::min(std::max(component * 127.5f + 127.5f, 0.0f), 255.0f) + 0.5f);
+}
+
+void SIMD_LEVEL_CLASS::FillNormalsFromHeights(uint8_t* normalMap, const float* heightSet, int heightStride, int xSize, int zSize, float strength, NormalMapFormat format)
+{
+	assert(normalMap);
+	assert(heightSet);
+	assert(heightStride >= zSize + 2);
+
+	int texelSize = format == RG8 ? 2 : 4;
+	float halfStrength = strength * 0.5f;
+
+	SIMDf halfStrengthV = SIMDf_SET(halfStrength);
+	SIMDf byteHalfV = SIMDf_SET(127.5f);
+	SIMDf byteMaxV = SIMDf_SET(255.0f);
+	SIMDi alphaV = SIMDi_SET(static_cast<int>(0xff000000u));
+
+	for (int x = 0; x < xSize; x++)
+	{
+		const float* above = heightSet + x * heightStride + 1;
+		const float* centre = above + heightStride;
+		const float* below = centre + heightStride;
+		uint8_t* texels = normalMap + x * zSize * texelSize;
+
+		int z = 0;
+
+		for (; z <= zSize - VECTOR_SIZE; z += VECTOR_SIZE)
+		{
+			SIMDf xNormal = SIMDf_MUL(SIMDf_SUB(SIMDf_LOAD_UNALIGNED(&centre[z - 1]), SIMDf_LOAD_UNALIGNED(&centre[z + 1])), halfStrengthV);
+			SIMDf yNormal = SIMDf_MUL(SIMDf_SUB(SIMDf_LOAD_UNALIGNED(&below[z]), SIMDf_LOAD_UNALIGNED(&above[z])), halfStrengthV);
+			SIMDf byteScale = SIMDf_MUL(SIMDf_INV_SQRT(SIMDf_MUL_ADD(xNormal, xNormal, SIMDf_MUL_ADD(yNormal, yNormal, SIMDf_NUM(1)))), byteHalfV);
+
+			SIMDi r = SIMDi_CONVERT_TO_INT(SIMDf_MIN(SIMDf_MAX(SIMDf_MUL_ADD(xNormal, byteScale, byteHalfV), SIMDf_NUM(0)), byteMaxV));
+			SIMDi g = SIMDi_CONVERT_TO_INT(SIMDf_MIN(SIMDf_MAX(SIMDf_MUL_ADD(yNormal, byteScale, byteHalfV), SIMDf_NUM(0)), byteMaxV));
+
+			// Texels are packed into the lanes little endian, RGBA8 stores them directly
+			SIMDi rg = SIMDi_OR(r, SIMDi_SHIFT_L(g, 8));
+
+			if (format == RG8)
+			{
+				int rgLanes[VECTOR_SIZE];
+				std::memcpy(rgLanes, &rg, sizeof(SIMDi));
+
+				for (int i = 0; i < VECTOR_SIZE; i++)
+				{
+					texels[(z + i) * 2] = static_cast<uint8_t>(rgLanes[i]);
+					texels[(z + i) * 2 + 1] = static_cast<uint8_t>(rgLanes[i] >> 8);
+				}
+			}
+			else
+			{
+				SIMDi b = SIMDi_CONVERT_TO_INT(SIMDf_MIN(SIMDf_ADD(byteScale, byteHalfV), byteMaxV));
+				SIMDi rgba = SIMDi_OR(SIMDi_OR(rg, SIMDi_SHIFT_L(b, 16)), alphaV);
+				std::memcpy(texels + z * 4, &rgba, sizeof(SIMDi));
+			}
+		}
+
+		for (; z < zSize; z++)
+		{
+			float xNormal = (centre[z - 1] - centre[z + 1]) * halfStrength;
+			float yNormal = (below[z] - above[z]) * halfStrength;
+			float invLength = 1.0f / std::sqrt(xNormal * xNormal + yNormal * yNormal + 1.0f);
+			uint8_t* texel = texels + z * texelSize;
+
+			texel[0] = FUNC(NormalToByte)(xNormal * invLength);
+			texel[1] = FUNC(NormalToByte)(yNormal * invLength);
+
+			if (format != RG8)
+			{
+				texel[2] = FUNC(NormalToByte)(invLength);
+				texel[3] = 255;
+			}
+		}
+	}
+}
+
+#define AXIS_RESET(_zSize, _start) for (int _i = (_zSize) * (_start); _i < VECTOR_SIZE; _i+=(_zSize)){\
+MASK _zReset = SIMDi_GREATER_THAN(z, zEndV);\
+y = SIMDi_MASK_ADD(_zReset, y, SIMDi_NUM(1));\
+z = SIMDi_MASK_SUB(_zReset, z, zSizeV);\
+\
+MASK _yReset = SIMDi_GREATER_THAN(y, yEndV);\
+x = SIMDi_MASK_ADD(_yReset, x, SIMDi_NUM(1));\
+y = SIMDi_MASK_SUB(_yReset, y, ySizeV);}
+
+#ifdef FN_ALIGNED_SETS
+#define STORE_LAST_RESULT(_dest, _source) SIMDf_STORE(_dest, _source)
+#elif SIMD_LEVEL_AVX512
+// Masked store of the lanes left in the set
+#define STORE_LAST_RESULT(_dest, _source) _mm512_mask_storeu_ps(_dest, (__mmask16)((1 << (maxIndex - index)) - 1), _source)
+#else
+#include <cstring>
+#define STORE_LAST_RESULT(_dest, _source) std::memcpy(_dest, &_source, (maxIndex - index) * 4)
+#endif
+
+#define INIT_PERTURB_VALUES() \
 SIMDf perturbAmpV, perturbFreqV, perturbLacunarityV, perturbGainV, perturbNormaliseLengthV;\
+LATTICE_CACHE_INIT(perturbCache);\
 switch (m_perturbType)\
 {\
 case None:\
@@ -1101,13 +1806,31 @@ case Normalise:\
 	break;\
 }
 
-#define PERTURB_SWITCH()\
-switch (m_perturbType)\
+// The perturb type and kernel share one switch, the simplex kernel runs out of line
+#ifdef SIMPLEX_ENABLED
+#define PERTURB_SIMPLEX_KERNEL (SimplexGradient << 3)
+#define PERTURB_SIMPLEX_CASES()\
+case Gradient + PERTURB_SIMPLEX_KERNEL:\
+case GradientFractal + PERTURB_SIMPLEX_KERNEL:\
+case Gradient_Normalise + PERTURB_SIMPLEX_KERNEL:\
+case GradientFractal_Normalise + PERTURB_SIMPLEX_KERNEL:\
+	FUNC(SimplexPerturb)(m_perturbType, m_perturbOctaves, SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV,\
+		perturbLacunarityV, perturbGainV, perturbNormaliseLengthV, xF, yF, zF);\
+	break;
+#else
+#define PERTURB_SIMPLEX_KERNEL (1 << 3)
+#define PERTURB_SIMPLEX_CASES()
+#endif
+
+#define PERTURB_CASE() (m_perturbType + (m_perturbKernel << 3))
+
+#define PERTURB_SWITCH_ON(_case)\
+switch (_case)\
 {\
 case None:\
 	break;\
 case Gradient:\
-	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF, perturbCache); \
 	break; \
 case GradientFractal:\
 	{\
@@ -1115,7 +1838,7 @@ case GradientFractal:\
 	SIMDf freqF = perturbFreqV;\
 	SIMDf ampF = perturbAmpV;\
 	\
-	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF, perturbCache);\
 	\
 	int octaveIndex = 0;\
 	\
@@ -1125,25 +1848,22 @@ case GradientFractal:\
 		seedF = SIMDi_SUB(seedF, SIMDi_NUM(1));\
 		ampF = SIMDf_MUL(ampF, perturbGainV);\
 		\
-		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF, perturbCache);\
 	}}\
 	break;\
 case Gradient_Normalise:\
-	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF); \
+	FUNC(GradientPerturbSingle)(SIMDi_SUB(seedV, SIMDi_NUM(1)), perturbAmpV, perturbFreqV, xF, yF, zF, perturbCache); \
 case Normalise:\
-	{\
-	SIMDf invMag = SIMDf_MUL(perturbNormaliseLengthV, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xF, xF, SIMDf_MUL_ADD(yF, yF, SIMDf_MUL(zF, zF)))));\
-	xF = SIMDf_MUL(xF, invMag);\
-	yF = SIMDf_MUL(yF, invMag);\
-	zF = SIMDf_MUL(zF, invMag);\
-	}break;\
+case Normalise + PERTURB_SIMPLEX_KERNEL:\
+	FUNC(PerturbNormalise)(perturbNormaliseLengthV, xF, yF, zF);\
+	break;\
 case GradientFractal_Normalise:\
 	{\
 	SIMDi seedF = SIMDi_SUB(seedV, SIMDi_NUM(1));\
 	SIMDf freqF = perturbFreqV;\
 	SIMDf ampF = perturbAmpV;\
 	\
-	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+	FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF, perturbCache);\
 	\
 	int octaveIndex = 0;\
 	\
@@ -1153,15 +1873,15 @@ case GradientFractal_Normalise:\
 		seedF = SIMDi_SUB(seedF, SIMDi_NUM(1));\
 		ampF = SIMDf_MUL(ampF, perturbGainV);\
 		\
-		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF);\
+		FUNC(GradientPerturbSingle)(seedF, ampF, freqF, xF, yF, zF, perturbCache);\
 	}\
-	SIMDf invMag = SIMDf_MUL(perturbNormaliseLengthV, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xF, xF, SIMDf_MUL_ADD(yF, yF, SIMDf_MUL(zF, zF)))));\
-	xF = SIMDf_MUL(xF, invMag);\
-	yF = SIMDf_MUL(yF, invMag);\
-	zF = SIMDf_MUL(zF, invMag);\
+	FUNC(PerturbNormalise)(perturbNormaliseLengthV, xF, yF, zF);\
 	}break;\
+PERTURB_SIMPLEX_CASES()\
 }
 
+#define PERTURB_SWITCH() PERTURB_SWITCH_ON(PERTURB_CASE())
+
 #define SET_BUILDER(f)\
 if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 {\
@@ -1188,6 +1908,7 @@ if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 			PERTURB_SWITCH()\
 			SIMDf result;\
 			f;\
+			result = SIMDf_POSITIVE_ZERO(result);\
 			SIMDf_STORE(&noiseSet[index], result);\
 			\
 			int iz = VECTOR_SIZE;\
@@ -1203,6 +1924,7 @@ if ((zSize & (VECTOR_SIZE - 1)) == 0)\
 				PERTURB_SWITCH()\
 				SIMDf result;\
 				f;\
+				result = SIMDf_POSITIVE_ZERO(result);\
 				SIMDf_STORE(&noiseSet[index], result);\
 			}\
 			index += VECTOR_SIZE;\
@@ -1236,6 +1958,7 @@ else\
 		PERTURB_SWITCH()\
 		SIMDf result;\
 		f;\
+		result = SIMDf_POSITIVE_ZERO(result);\
 		SIMDf_STORE(&noiseSet[index], result);\
 		\
 		z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));\
@@ -1250,71 +1973,167 @@ else\
 	PERTURB_SWITCH()\
 	SIMDf result;\
 	f;\
+	result = SIMDf_POSITIVE_ZERO(result);\
 	STORE_LAST_RESULT(&noiseSet[index], result);\
 }
 
-// FBM SINGLE
-#define FBM_SINGLE(f)\
-	SIMDi seedF = seedV;\
-	\
-	result = FUNC(f##Single)(seedF, xF, yF, zF);\
+// Octave loop shared by the fractal types
+// The noise of two octaves is evaluated before either is combined. Octave noise only depends on the coordinates and
+// seed, so the two long hash/lerp chains are independent and can be scheduled side by side, while the combine step
+// still runs in octave order and the result is the same as evaluating one octave at a time
+#define FRACTAL_OCTAVE_LOOP(_noise, _octave)\
+	int octaveIndex = 1;\
 	\
-	SIMDf ampF = SIMDf_NUM(1);\
-	int octaveIndex = 0;\
+	for (; octaveIndex + 1 < m_octaves; octaveIndex += 2)\
+	{\
+		SIMDf xPairF = SIMDf_MUL(xF, lacunarityV);\
+		SIMDf yPairF = SIMDf_MUL(yF, lacunarityV);\
+		SIMDf zPairF = SIMDf_MUL(zF, lacunarityV);\
+		SIMDi seedPairF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
+		\
+		xF = SIMDf_MUL(xPairF, lacunarityV);\
+		yF = SIMDf_MUL(yPairF, lacunarityV);\
+		zF = SIMDf_MUL(zPairF, lacunarityV);\
+		seedF = SIMDi_ADD(seedPairF, SIMDi_NUM(1));\
+		\
+		SIMDf noisePairF;\
+		{\
+			SIMDf xF = xPairF;\
+			SIMDf yF = yPairF;\
+			SIMDf zF = zPairF;\
+			SIMDi seedF = seedPairF;\
+			noisePairF = _noise;\
+		}\
+		SIMDf noiseF = _noise;\
+		\
+		_octave(noisePairF);\
+		_octave(noiseF);\
+	}\
 	\
-	while (++octaveIndex < m_octaves)\
+	if (octaveIndex < m_octaves)\
 	{\
 		xF = SIMDf_MUL(xF, lacunarityV);\
 		yF = SIMDf_MUL(yF, lacunarityV);\
 		zF = SIMDf_MUL(zF, lacunarityV);\
 		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
 		\
-		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_MUL_ADD(FUNC(f##Single)(seedF, xF, yF, zF), ampF, result);\
-	}\
+		SIMDf noiseF = _noise;\
+		_octave(noiseF);\
+	}
+
+// FBM SINGLE
+#define FBM_SINGLE(f) FBM_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+// Octave loop around any noise expression of seedF, xF, yF, zF
+#define FBM_OCTAVES(_noise)\
+	SIMDi seedF = seedV;\
+	\
+	result = _noise;\
+	\
+	SIMDf ampF = SIMDf_NUM(1);\
+	FRACTAL_OCTAVE_LOOP(_noise, FBM_OCTAVE);\
 	result = SIMDf_MUL(result, fractalBoundingV)
 
+#define FBM_OCTAVE(_n)\
+	ampF = SIMDf_MUL(ampF, gainV);\
+	result = SIMDf_MUL_ADD(_n, ampF, result)
+
 // BILLOW SINGLE
-#define BILLOW_SINGLE(f)\
+#define BILLOW_SINGLE(f) BILLOW_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+#define BILLOW_OCTAVES(_noise)\
 	SIMDi seedF = seedV;\
 	\
-	result = SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1));\
+	result = SIMDf_MUL_SUB(SIMDf_ABS(_noise), SIMDf_NUM(2), SIMDf_NUM(1));\
 	\
 	SIMDf ampF = SIMDf_NUM(1);\
-	int octaveIndex = 0;\
-	\
-	while (++octaveIndex < m_octaves)\
-	{\
-		xF = SIMDf_MUL(xF, lacunarityV);\
-		yF = SIMDf_MUL(yF, lacunarityV);\
-		zF = SIMDf_MUL(zF, lacunarityV);\
-		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
-		\
-		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_MUL_ADD(SIMDf_MUL_SUB(SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)), SIMDf_NUM(2), SIMDf_NUM(1)), ampF, result);\
-	}\
+	FRACTAL_OCTAVE_LOOP(_noise, BILLOW_OCTAVE);\
 	result = SIMDf_MUL(result, fractalBoundingV)
 
+#define BILLOW_OCTAVE(_n)\
+	ampF = SIMDf_MUL(ampF, gainV);\
+	result = SIMDf_MUL_ADD(SIMDf_MUL_SUB(SIMDf_ABS(_n), SIMDf_NUM(2), SIMDf_NUM(1)), ampF, result)
+
 // RIGIDMULTI SINGLE
-#define RIGIDMULTI_SINGLE(f)\
+#define RIGIDMULTI_SINGLE(f) RIGIDMULTI_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+#define RIGIDMULTI_OCTAVES(_noise)\
 	SIMDi seedF = seedV;\
 	\
-	result = SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF)));\
+	result = SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(_noise));\
 	\
 	SIMDf ampF = SIMDf_NUM(1);\
-	int octaveIndex = 0;\
+	FRACTAL_OCTAVE_LOOP(_noise, RIGIDMULTI_OCTAVE)
+
+#define RIGIDMULTI_OCTAVE(_n)\
+	ampF = SIMDf_MUL(ampF, gainV);\
+	result = SIMDf_NMUL_ADD(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(_n)), ampF, result)
+
+// RIGIDMULTIFEEDBACK SINGLE
+// Musgrave's ridged multifractal, each octave is weighted by the one before it so detail gathers along the ridges
+#define RIGIDMULTIFEEDBACK_SINGLE(f) RIGIDMULTIFEEDBACK_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+#define RIGIDMULTIFEEDBACK_OCTAVES(_noise)\
+	SIMDi seedF = seedV;\
 	\
-	while (++octaveIndex < m_octaves)\
+	SIMDf signalF = SIMDf_SUB(fractalOffsetV, SIMDf_ABS(_noise));\
+	signalF = SIMDf_MUL(signalF, signalF);\
+	result = signalF;\
+	\
+	SIMDf ampF = SIMDf_NUM(1);\
+	FRACTAL_OCTAVE_LOOP(_noise, RIGIDMULTIFEEDBACK_OCTAVE);\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+#define RIGIDMULTIFEEDBACK_OCTAVE(_n)\
 	{\
-		xF = SIMDf_MUL(xF, lacunarityV);\
-		yF = SIMDf_MUL(yF, lacunarityV);\
-		zF = SIMDf_MUL(zF, lacunarityV);\
-		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
+		SIMDf weightF = SIMDf_MIN(SIMDf_MAX(SIMDf_MUL(signalF, fractalFeedbackV), SIMDf_NUM(0)), SIMDf_NUM(1));\
+		signalF = SIMDf_SUB(fractalOffsetV, SIMDf_ABS(_n));\
+		signalF = SIMDf_MUL(SIMDf_MUL(signalF, signalF), weightF);\
 		\
 		ampF = SIMDf_MUL(ampF, gainV);\
-		result = SIMDf_NMUL_ADD(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(FUNC(f##Single)(seedF, xF, yF, zF))), ampF, result);\
+		result = SIMDf_MUL_ADD(signalF, ampF, result);\
+	}
+
+// HYBRIDMULTI SINGLE
+// Musgrave's hybrid multifractal, each octave is weighted by the product of the ones before it so valleys stay smooth
+#define HYBRIDMULTI_SINGLE(f) HYBRIDMULTI_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+#define HYBRIDMULTI_OCTAVES(_noise)\
+	SIMDi seedF = seedV;\
+	\
+	result = SIMDf_ADD(_noise, fractalOffsetV);\
+	SIMDf weightF = result;\
+	\
+	SIMDf ampF = SIMDf_NUM(1);\
+	FRACTAL_OCTAVE_LOOP(_noise, HYBRIDMULTI_OCTAVE);\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+#define HYBRIDMULTI_OCTAVE(_n)\
+	{\
+		ampF = SIMDf_MUL(ampF, gainV);\
+		weightF = SIMDf_MIN(weightF, SIMDf_NUM(1));\
+		SIMDf signalF = SIMDf_MUL(SIMDf_ADD(_n, fractalOffsetV), ampF);\
+		result = SIMDf_MUL_ADD(signalF, weightF, result);\
+		weightF = SIMDf_MUL(weightF, signalF);\
 	}
 
+// HETEROTERRAIN SINGLE
+// Musgrave's heterogeneous terrain, each octave is scaled by the height so far so low areas stay smooth
+#define HETEROTERRAIN_SINGLE(f) HETEROTERRAIN_OCTAVES(FUNC(f##Single)(seedF, xF, yF, zF))
+
+#define HETEROTERRAIN_OCTAVES(_noise)\
+	SIMDi seedF = seedV;\
+	\
+	result = SIMDf_ADD(_noise, fractalOffsetV);\
+	\
+	SIMDf ampF = SIMDf_NUM(1);\
+	FRACTAL_OCTAVE_LOOP(_noise, HETEROTERRAIN_OCTAVE);\
+	result = SIMDf_MUL(result, fractalBoundingV)
+
+#define HETEROTERRAIN_OCTAVE(_n)\
+	ampF = SIMDf_MUL(ampF, gainV);\
+	result = SIMDf_MUL_ADD(SIMDf_MUL(SIMDf_ADD(_n, fractalOffsetV), ampF), result, result)
+
 #define FILL_SET(func) \
 void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)\
 {\
@@ -1344,6 +2163,8 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, int xStart, int y
 	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
 	SIMDf gainV = SIMDf_SET(m_gain);\
 	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);\
+	SIMDf fractalOffsetV = SIMDf_SET(m_fractalOffset);\
+	SIMDf fractalFeedbackV = SIMDf_SET(m_fractalFeedback);\
 	INIT_PERTURB_VALUES();\
 	\
 	scaleModifier *= m_frequency;\
@@ -1363,121 +2184,772 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, int xStart, int y
 	case RigidMulti:\
 		SET_BUILDER(RIGIDMULTI_SINGLE(func))\
 		break;\
+	case RigidMultiFeedback:\
+		SET_BUILDER(RIGIDMULTIFEEDBACK_SINGLE(func))\
+		break;\
+	case HybridMulti:\
+		SET_BUILDER(HYBRIDMULTI_SINGLE(func))\
+		break;\
+	case HeteroTerrain:\
+		SET_BUILDER(HETEROTERRAIN_SINGLE(func))\
+		break;\
 	}\
 	SIMD_ZERO_ALL();\
 }
 
-FILL_SET(Value)
-FILL_FRACTAL_SET(Value)
-
-FILL_SET(Perlin)
-FILL_FRACTAL_SET(Perlin)
-
-FILL_SET(Simplex)
-FILL_FRACTAL_SET(Simplex)
-
-//FILL_SET(WhiteNoise)
+// Sets where every sample is on the integer lattice only need the corner values, see IsLatticeSet()
+#define LATTICE_FAST_PATH(func)\
+if (IsLatticeSet(xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier, 1))\
+{\
+	SET_BUILDER(result = FUNC(func##LatticeSingle)(seedV, xF, yF, zF))\
+	SIMD_ZERO_ALL();\
+	return;\
+}
 
-FILL_SET(Cubic)
-FILL_FRACTAL_SET(Cubic)
+#define LATTICE_FRACTAL_FAST_PATH(func)\
+if (IsLatticeSet(xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier, m_octaves))\
+{\
+	switch(m_fractalType)\
+	{\
+	case FBM:\
+		SET_BUILDER(FBM_SINGLE(func##Lattice))\
+		break;\
+	case Billow:\
+		SET_BUILDER(BILLOW_SINGLE(func##Lattice))\
+		break;\
+	case RigidMulti:\
+		SET_BUILDER(RIGIDMULTI_SINGLE(func##Lattice))\
+		break;\
+	case RigidMultiFeedback:\
+		SET_BUILDER(RIGIDMULTIFEEDBACK_SINGLE(func##Lattice))\
+		break;\
+	case HybridMulti:\
+		SET_BUILDER(HYBRIDMULTI_SINGLE(func##Lattice))\
+		break;\
+	case HeteroTerrain:\
+		SET_BUILDER(HETEROTERRAIN_SINGLE(func##Lattice))\
+		break;\
+	}\
+	SIMD_ZERO_ALL();\
+	return;\
+}
 
-#ifdef FN_ALIGNED_SETS
-#define SIZE_MASK
-#define SAFE_LAST(f)
-#else
-#define SIZE_MASK & ~(VECTOR_SIZE - 1)
-#define SAFE_LAST(f)\
-if (loopMax != vectorSet->size)\
+// Fast precision goes through func##FastCachedSingle instead, see SetPrecision()
+#define PRECISION_FAST_PATH(func, _cacheInit)\
+if (m_precision == Fast)\
 {\
-	std::size_t remaining = (vectorSet->size - loopMax) * 4;\
-	\
-	SIMDf xF = SIMDf_LOAD(&vectorSet->xSet[loopMax]);\
-	SIMDf yF = SIMDf_LOAD(&vectorSet->ySet[loopMax]);\
-	SIMDf zF = SIMDf_LOAD(&vectorSet->zSet[loopMax]);\
-	\
-	xF = SIMDf_MUL_ADD(xF, xFreqV, xOffsetV);\
-	yF = SIMDf_MUL_ADD(yF, yFreqV, yOffsetV);\
-	zF = SIMDf_MUL_ADD(zF, zFreqV, zOffsetV);\
-	\
-	SIMDf result;\
-	f;\
-	std::memcpy(&noiseSet[index], &result, remaining);\
+	_cacheInit(fastCache);\
+	SET_BUILDER(result = FUNC(func##FastCachedSingle)(seedV, xF, yF, zF, fastCache))\
+	SIMD_ZERO_ALL();\
+	return;\
 }
-#endif
 
-#define VECTOR_SET_BUILDER(f)\
-while (index < loopMax)\
+#define PRECISION_FRACTAL_FAST_PATH(func, _cacheInit)\
+if (m_precision == Fast)\
 {\
-	SIMDf xF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->xSet[index]), xFreqV, xOffsetV);\
-	SIMDf yF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->ySet[index]), yFreqV, yOffsetV);\
-	SIMDf zF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->zSet[index]), zFreqV, zOffsetV);\
-	\
-	PERTURB_SWITCH()\
-	SIMDf result;\
-	f;\
-	SIMDf_STORE(&noiseSet[index], result);\
-	index += VECTOR_SIZE;\
-}\
-SAFE_LAST(f)
+	_cacheInit(fastCache);\
+	switch(m_fractalType)\
+	{\
+	case FBM:\
+		SET_BUILDER(FBM_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	case Billow:\
+		SET_BUILDER(BILLOW_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	case RigidMulti:\
+		SET_BUILDER(RIGIDMULTI_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	case RigidMultiFeedback:\
+		SET_BUILDER(RIGIDMULTIFEEDBACK_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	case HybridMulti:\
+		SET_BUILDER(HYBRIDMULTI_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	case HeteroTerrain:\
+		SET_BUILDER(HETEROTERRAIN_OCTAVES(FUNC(func##FastCachedSingle)(seedF, xF, yF, zF, fastCache)))\
+		break;\
+	}\
+	SIMD_ZERO_ALL();\
+	return;\
+}
 
-#define FILL_VECTOR_SET(func)\
-void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)\
+// Same as FILL_SET/FILL_FRACTAL_SET, but go through func##CachedSingle with a cache local to the fill
+// _fastPath is checked first and may fill the set and return, it can be left empty
+#define FILL_CACHED_SET(func, _cacheInit, _fastPath) \
+void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)\
 {\
 	assert(noiseSet);\
-	assert(vectorSet);\
-	assert(vectorSet->size >= 0);\
 	SIMD_ZERO_ALL();\
-	\
-	SIMDi seedV = SIMDi_SET(m_seed);\
-	SIMDf xFreqV = SIMDf_SET(m_frequency * m_xScale);\
-	SIMDf yFreqV = SIMDf_SET(m_frequency * m_yScale);\
-	SIMDf zFreqV = SIMDf_SET(m_frequency * m_zScale);\
-	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);\
-	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
-	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
+	SIMDi seedV = SIMDi_SET(m_seed); \
 	INIT_PERTURB_VALUES();\
 	\
-	int index = 0;\
-	int loopMax = vectorSet->size SIZE_MASK;\
+	scaleModifier *= m_frequency;\
+	\
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);\
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);\
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);\
+	\
+	_fastPath\
+	\
+	_cacheInit(noiseCache);\
+	\
+	SET_BUILDER(result = FUNC(func##CachedSingle)(seedV, xF, yF, zF, noiseCache))\
 	\
-	VECTOR_SET_BUILDER(result = FUNC(func##Single)(seedV, xF, yF, zF))\
 	SIMD_ZERO_ALL();\
 }
 
-#define FILL_FRACTAL_VECTOR_SET(func)\
-void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)\
+#define FILL_CACHED_FRACTAL_SET(func, _cacheInit, _fastPath) \
+void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)\
 {\
 	assert(noiseSet);\
-	assert(vectorSet);\
-	assert(vectorSet->size >= 0);\
 	SIMD_ZERO_ALL();\
 	\
 	SIMDi seedV = SIMDi_SET(m_seed);\
 	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
 	SIMDf gainV = SIMDf_SET(m_gain);\
 	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);\
-	SIMDf xFreqV = SIMDf_SET(m_frequency * m_xScale);\
-	SIMDf yFreqV = SIMDf_SET(m_frequency * m_yScale);\
-	SIMDf zFreqV = SIMDf_SET(m_frequency * m_zScale);\
-	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);\
-	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
-	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
+	SIMDf fractalOffsetV = SIMDf_SET(m_fractalOffset);\
+	SIMDf fractalFeedbackV = SIMDf_SET(m_fractalFeedback);\
 	INIT_PERTURB_VALUES();\
 	\
-	int index = 0;\
-	int loopMax = vectorSet->size SIZE_MASK;\
+	scaleModifier *= m_frequency;\
 	\
-	switch(m_fractalType)\
-	{\
-	case FBM:\
-		VECTOR_SET_BUILDER(FBM_SINGLE(func))\
-		break;\
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);\
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);\
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);\
+	\
+	_fastPath\
+	\
+	_cacheInit(noiseCache);\
+	\
+	switch(m_fractalType)\
+	{\
+	case FBM:\
+		SET_BUILDER(FBM_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	case Billow:\
+		SET_BUILDER(BILLOW_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	case RigidMulti:\
+		SET_BUILDER(RIGIDMULTI_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	case RigidMultiFeedback:\
+		SET_BUILDER(RIGIDMULTIFEEDBACK_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	case HybridMulti:\
+		SET_BUILDER(HYBRIDMULTI_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	case HeteroTerrain:\
+		SET_BUILDER(HETEROTERRAIN_OCTAVES(FUNC(func##CachedSingle)(seedF, xF, yF, zF, noiseCache)))\
+		break;\
+	}\
+	SIMD_ZERO_ALL();\
+}
+
+FILL_CACHED_SET(Value, LATTICE_CACHE_INIT, LATTICE_FAST_PATH(Value) PRECISION_FAST_PATH(Value, LATTICE_CACHE_INIT))
+FILL_CACHED_FRACTAL_SET(Value, LATTICE_CACHE_INIT, LATTICE_FRACTAL_FAST_PATH(Value) PRECISION_FRACTAL_FAST_PATH(Value, LATTICE_CACHE_INIT))
+
+FILL_CACHED_SET(Perlin, LATTICE_CACHE_INIT, PRECISION_FAST_PATH(Perlin, LATTICE_CACHE_INIT))
+FILL_CACHED_FRACTAL_SET(Perlin, LATTICE_CACHE_INIT, PRECISION_FRACTAL_FAST_PATH(Perlin, LATTICE_CACHE_INIT))
+
+FILL_SET(Simplex)
+FILL_FRACTAL_SET(Simplex)
+
+//FILL_SET(WhiteNoise)
+
+FILL_CACHED_SET(Cubic, CUBIC_CACHE_INIT, LATTICE_FAST_PATH(Cubic))
+FILL_CACHED_FRACTAL_SET(Cubic, CUBIC_CACHE_INIT, LATTICE_FRACTAL_FAST_PATH(Cubic))
+
+// Fractal with early out for threshold sets
+// Before each octave the remaining octaves are checked for being able to move lanes across the iso level
+// _low/_high is the range the remaining octaves can add per unit of amplitude
+#define FRACTAL_THRESHOLD_SINGLE(f, _first, _octave, _low, _high)\
+	SIMDi seedF = seedV;\
+	SIMDf noiseF = FUNC(f##Single)(seedF, xF, yF, zF);\
+	\
+	result = _first;\
+	\
+	SIMDf ampF = SIMDf_NUM(1);\
+	float amp = 1.0f;\
+	float ampRemaining = ampTotal - 1.0f;\
+	int octaveIndex = 0;\
+	bool decided = false;\
+	\
+	while (++octaveIndex < m_octaves)\
+	{\
+		MASK above = SIMDf_GREATER_THAN(SIMDf_ADD(result, SIMDf_SET(ampRemaining * (_low) - ampMargin)), isoUnscaledV);\
+		MASK below = SIMDf_LESS_THAN(SIMDf_ADD(result, SIMDf_SET(ampRemaining * (_high) + ampMargin)), isoUnscaledV);\
+		\
+		if (MASK_ALL(MASK_OR(above, below)))\
+		{\
+			result = SIMDf_MASK(above, SIMDf_NUM(1));\
+			decided = true;\
+			break;\
+		}\
+		\
+		xF = SIMDf_MUL(xF, lacunarityV);\
+		yF = SIMDf_MUL(yF, lacunarityV);\
+		zF = SIMDf_MUL(zF, lacunarityV);\
+		seedF = SIMDi_ADD(seedF, SIMDi_NUM(1));\
+		\
+		ampF = SIMDf_MUL(ampF, gainV);\
+		amp *= m_gain;\
+		ampRemaining -= amp;\
+		noiseF = FUNC(f##Single)(seedF, xF, yF, zF);\
+		result = _octave;\
+	}\
+	if (!decided)\
+		result = SIMDf_MASK(SIMDf_GREATER_THAN(SIMDf_MUL(result, resultScaleV), isoV), SIMDf_NUM(1))
+
+#define FRACTAL_THRESHOLD_SET(func)\
+{\
+	float octaveBound = GetOctaveBound(m_noiseType);\
+	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
+	SIMDf gainV = SIMDf_SET(m_gain);\
+	SIMDf isoV = SIMDf_SET(isoLevel);\
+	SIMDf resultScaleV, isoUnscaledV;\
+	\
+	float ampTotal = 1.0f / CalculateFractalBounding(m_octaves, m_gain);\
+	float ampMargin = ampTotal * 1e-4f;\
+	\
+	switch (m_fractalType)\
+	{\
+	case FBM:\
+		resultScaleV = SIMDf_SET(m_fractalBounding);\
+		isoUnscaledV = SIMDf_SET(isoLevel / m_fractalBounding);\
+		SET_BUILDER(FRACTAL_THRESHOLD_SINGLE(func, noiseF, SIMDf_MUL_ADD(noiseF, ampF, result), -octaveBound, octaveBound))\
+		break;\
+	case Billow:\
+		resultScaleV = SIMDf_SET(m_fractalBounding);\
+		isoUnscaledV = SIMDf_SET(isoLevel / m_fractalBounding);\
+		SET_BUILDER(FRACTAL_THRESHOLD_SINGLE(func, SIMDf_MUL_SUB(SIMDf_ABS(noiseF), SIMDf_NUM(2), SIMDf_NUM(1)),\
+			SIMDf_MUL_ADD(SIMDf_MUL_SUB(SIMDf_ABS(noiseF), SIMDf_NUM(2), SIMDf_NUM(1)), ampF, result), -1.0f, octaveBound * 2.0f - 1.0f))\
+		break;\
+	case RigidMulti:\
+		resultScaleV = SIMDf_NUM(1);\
+		isoUnscaledV = isoV;\
+		SET_BUILDER(FRACTAL_THRESHOLD_SINGLE(func, SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(noiseF)),\
+			SIMDf_NMUL_ADD(SIMDf_SUB(SIMDf_NUM(1), SIMDf_ABS(noiseF)), ampF, result), -1.0f, octaveBound - 1.0f))\
+		break;\
+	default:\
+		break;\
+	}\
+}
+
+void SIMD_LEVEL_CLASS::FillThresholdSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float isoLevel, float scaleModifier)
+{
+	assert(noiseSet);
+
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+	case PerlinFractal:
+#ifdef SIMPLEX_ENABLED
+	case SimplexFractal:
+#endif
+	case CubicFractal:
+		// Multifractal octaves depend on the octaves before them, so there's no fixed range left to check against
+		if (m_fractalType != RigidMultiFeedback && m_fractalType != HybridMulti && m_fractalType != HeteroTerrain)
+			break;
+	default:
+	{
+		// Nothing to skip, threshold the full noise
+		FillNoiseSet(noiseSet, xStart, yStart, zStart, xSize, ySize, zSize, scaleModifier);
+
+		int size = xSize * ySize * zSize;
+		for (int i = 0; i < size; i++)
+			noiseSet[i] = noiseSet[i] > isoLevel ? 1.0f : 0.0f;
+		return;
+	}
+	}
+
+	SIMD_ZERO_ALL();
+	SIMDi seedV = SIMDi_SET(m_seed);
+	INIT_PERTURB_VALUES();
+
+	scaleModifier *= m_frequency;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);
+
+	switch (m_noiseType)
+	{
+	case ValueFractal:
+		FRACTAL_THRESHOLD_SET(Value)
+		break;
+	case PerlinFractal:
+		FRACTAL_THRESHOLD_SET(Perlin)
+		break;
+#ifdef SIMPLEX_ENABLED
+	case SimplexFractal:
+		FRACTAL_THRESHOLD_SET(Simplex)
+		break;
+#endif
+	case CubicFractal:
+		FRACTAL_THRESHOLD_SET(Cubic)
+		break;
+	default:
+		break;
+	}
+	SIMD_ZERO_ALL();
+}
+
+// Bounds are sampled on a grid of at most BOUNDS_GRID^3 sub boxes per octave
+#define BOUNDS_GRID 4
+#define BOUNDS_VECTORS ((BOUNDS_GRID * BOUNDS_GRID * BOUNDS_GRID + VECTOR_SIZE - 1) / VECTOR_SIZE)
+
+#define BOUNDS_SAMPLE(f)\
+for (int i = 0; i < sampleVectors; i++)\
+	sampleResult[i] = FUNC(f##Single)(seedF, sampleX[i], sampleY[i], sampleZ[i])
+
+// Fast precision sets interpolate with InterpHermite, its slope of at most 1.5 stays below the quintic 15/8 the Lipschitz constants use
+#define BOUNDS_SAMPLE_PRECISION(f)\
+if (m_precision == Fast)\
+{\
+	for (int i = 0; i < sampleVectors; i++)\
+		sampleResult[i] = FUNC(f##FastCachedSingle)(seedF, sampleX[i], sampleY[i], sampleZ[i], boundsCache);\
+}\
+else\
+	BOUNDS_SAMPLE(f)
+
+// Range of the product of two ranges
+static void FUNC(BoundsMul)(float aMin, float aMax, float bMin, float bMax, float& minOut, float& maxOut)
+{
+	float p0 = aMin * bMin;
+	float p1 = aMin * bMax;
+	float p2 = aMax * bMin;
+	float p3 = aMax * bMax;
+
+	minOut = std::min(std::min(p0, p1), std::min(p2, p3));
+	maxOut = std::max(std::max(p0, p1), std::max(p2, p3));
+}
+
+bool SIMD_LEVEL_CLASS::GetNoiseBounds(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float& minOut, float& maxOut, float scaleModifier)
+{
+	NoiseType noiseType;
+	float lipschitz;
+
+	// Lipschitz constants are per axis, in lattice units
+	switch (m_noiseType)
+	{
+	case Value:
+	case ValueFractal:
+		// Value difference of 2 times the max quintic slope of 15/8
+		noiseType = Value;
+		lipschitz = 3.75f;
+		break;
+	case Perlin:
+	case PerlinFractal:
+		// Max gradient component of 1, plus 15/8 times the max corner difference of 4
+		noiseType = Perlin;
+		lipschitz = 8.5f;
+		break;
+#ifdef SIMPLEX_ENABLED
+	case Simplex:
+	case SimplexFractal:
+		// Max kernel slope of 0.232 for each of the 4 corners, times 32
+		noiseType = Simplex;
+		lipschitz = 30.0f;
+		break;
+#endif
+	case Cubic:
+	case CubicFractal:
+		// Cubic weight slopes sum to at most 3, times 1.5^2 for the other axes, times the cubic bounding
+		noiseType = Cubic;
+		lipschitz = 2.0f;
+		break;
+	case WhiteNoise:
+		minOut = -1.0f;
+		maxOut = 1.0f;
+		return true;
+	default:
+		return false;
+	}
+
+	int octaves = noiseType != m_noiseType ? m_octaves : 1;
+	float octaveBound = GetOctaveBound(noiseType);
+
+	scaleModifier *= m_frequency;
+
+	float xFreq = scaleModifier * m_xScale;
+	float yFreq = scaleModifier * m_yScale;
+	float zFreq = scaleModifier * m_zScale;
+
+	// Region box in noise space
+	float xCenter = (xStart + (xSize - 1) * 0.5f) * xFreq;
+	float yCenter = (yStart + (ySize - 1) * 0.5f) * yFreq;
+	float zCenter = (zStart + (zSize - 1) * 0.5f) * zFreq;
+	float xHalf = std::abs((xSize - 1) * 0.5f * xFreq);
+	float yHalf = std::abs((ySize - 1) * 0.5f * yFreq);
+	float zHalf = std::abs((zSize - 1) * 0.5f * zFreq);
+
+	// Perturb moves each axis at most by the perturb amplitude, times the octave bound of simplex
+	bool unboxed = false;
+	float perturbDistance = 0.0f;
+	float perturbBound = 511.5f;
+
+#ifdef SIMPLEX_ENABLED
+	if (m_perturbKernel == SimplexGradient)
+		perturbBound *= GetOctaveBound(Simplex);
+#endif
+
+	switch (m_perturbType)
+	{
+	case None:
+		break;
+	case Gradient:
+		perturbDistance = m_perturbAmp * perturbBound;
+		break;
+	case GradientFractal:
+	{
+		float perturbAmp = m_perturbAmp * perturbBound * m_fractalBounding;
+
+		for (int i = 0; i < m_perturbOctaves; i++)
+		{
+			perturbDistance += perturbAmp;
+			perturbAmp *= m_perturbGain;
+		}
+		break;
+	}
+	default:
+		// Normalised positions can come from anywhere on the sphere
+		unboxed = true;
+		break;
+	}
+
+	// Also cover float rounding of the sample positions
+	xHalf += perturbDistance + (std::abs(xCenter) + xHalf + perturbDistance) * 1e-5f;
+	yHalf += perturbDistance + (std::abs(yCenter) + yHalf + perturbDistance) * 1e-5f;
+	zHalf += perturbDistance + (std::abs(zCenter) + zHalf + perturbDistance) * 1e-5f;
+
+	SIMD_ZERO_ALL();
+
+	SIMDf sampleX[BOUNDS_VECTORS];
+	SIMDf sampleY[BOUNDS_VECTORS];
+	SIMDf sampleZ[BOUNDS_VECTORS];
+	SIMDf sampleResult[BOUNDS_VECTORS];
+	LATTICE_CACHE_INIT(boundsCache);
+
+	float minSum = 0.0f;
+	float maxSum = 0.0f;
+	float amp = 1.0f;
+	float ampSum = 0.0f;
+
+	// Range of the previous octave's signal for RigidMultiFeedback, or of the running weight for HybridMulti
+	float signalMin = 0.0f;
+	float signalMax = 0.0f;
+
+	for (int octave = 0; octave < octaves; octave++)
+	{
+		float octaveMin = -octaveBound;
+		float octaveMax = octaveBound;
+		float spread = lipschitz * (xHalf + yHalf + zHalf);
+
+		if (!unboxed && spread < octaveBound * BOUNDS_GRID)
+		{
+			// Sample the center of each sub box, the noise in a sub box is within its spread of the center
+			int grid = 1;
+			while (grid < BOUNDS_GRID && spread > octaveBound * 0.25f * grid)
+				grid++;
+
+			int sampleCount = grid * grid * grid;
+			int sampleVectors = (sampleCount + VECTOR_SIZE - 1) / VECTOR_SIZE;
+			float* xSample = reinterpret_cast<float*>(sampleX);
+			float* ySample = reinterpret_cast<float*>(sampleY);
+			float* zSample = reinterpret_cast<float*>(sampleZ);
+			int index = 0;
+
+			for (int ix = 0; ix < grid; ix++)
+			{
+				for (int iy = 0; iy < grid; iy++)
+				{
+					for (int iz = 0; iz < grid; iz++)
+					{
+						xSample[index] = xCenter + xHalf * ((ix * 2 + 1) / float(grid) - 1.0f);
+						ySample[index] = yCenter + yHalf * ((iy * 2 + 1) / float(grid) - 1.0f);
+						zSample[index] = zCenter + zHalf * ((iz * 2 + 1) / float(grid) - 1.0f);
+						index++;
+					}
+				}
+			}
+			// Unused lanes repeat the first sample
+			for (; index < sampleVectors * VECTOR_SIZE; index++)
+			{
+				xSample[index] = xSample[0];
+				ySample[index] = ySample[0];
+				zSample[index] = zSample[0];
+			}
+
+			SIMDi seedF = SIMDi_SET(m_seed + octave);
+
+			switch (noiseType)
+			{
+			case Value:
+				BOUNDS_SAMPLE_PRECISION(Value);
+				break;
+			case Perlin:
+				BOUNDS_SAMPLE_PRECISION(Perlin);
+				break;
+#ifdef SIMPLEX_ENABLED
+			case Simplex:
+				BOUNDS_SAMPLE(Simplex);
+				break;
+#endif
+			case Cubic:
+				BOUNDS_SAMPLE(Cubic);
+				break;
+			default:
+				break;
+			}
+
+			float* result = reinterpret_cast<float*>(sampleResult);
+			float sampleMin = result[0];
+			float sampleMax = result[0];
+
+			for (int i = 1; i < sampleCount; i++)
+			{
+				sampleMin = std::min(sampleMin, result[i]);
+				sampleMax = std::max(sampleMax, result[i]);
+			}
+
+			spread /= grid;
+			octaveMin = std::max(octaveMin, sampleMin - spread);
+			octaveMax = std::min(octaveMax, sampleMax + spread);
+		}
+
+		switch (noiseType == m_noiseType ? FBM : m_fractalType)
+		{
+		case FBM:
+			minSum += octaveMin * amp;
+			maxSum += octaveMax * amp;
+			break;
+		case Billow:
+		{
+			// 2|n| - 1
+			float absMin = octaveMin > 0.0f ? octaveMin : (octaveMax < 0.0f ? -octaveMax : 0.0f);
+			float absMax = std::max(std::abs(octaveMin), std::abs(octaveMax));
+			minSum += (absMin * 2.0f - 1.0f) * amp;
+			maxSum += (absMax * 2.0f - 1.0f) * amp;
+			break;
+		}
+		case RigidMulti:
+		{
+			// First octave adds 1 - |n|, the rest subtract it
+			float absMin = octaveMin > 0.0f ? octaveMin : (octaveMax < 0.0f ? -octaveMax : 0.0f);
+			float absMax = std::max(std::abs(octaveMin), std::abs(octaveMax));
+			if (octave == 0)
+			{
+				minSum += 1.0f - absMax;
+				maxSum += 1.0f - absMin;
+			}
+			else
+			{
+				minSum -= (1.0f - absMin) * amp;
+				maxSum -= (1.0f - absMax) * amp;
+			}
+			break;
+		}
+		case RigidMultiFeedback:
+		{
+			// (offset - |n|)^2, after the first octave weighted by the previous signal times the feedback clamped to [0, 1]
+			float absMin = octaveMin > 0.0f ? octaveMin : (octaveMax < 0.0f ? -octaveMax : 0.0f);
+			float absMax = std::max(std::abs(octaveMin), std::abs(octaveMax));
+			float ridgeMin = m_fractalOffset - absMax;
+			float ridgeMax = m_fractalOffset - absMin;
+			float squareMin = ridgeMin > 0.0f ? ridgeMin * ridgeMin : (ridgeMax < 0.0f ? ridgeMax * ridgeMax : 0.0f);
+			float squareMax = std::max(ridgeMin * ridgeMin, ridgeMax * ridgeMax);
+
+			if (octave > 0)
+			{
+				float weightMin, weightMax;
+				FUNC(BoundsMul)(signalMin, signalMax, m_fractalFeedback, m_fractalFeedback, weightMin, weightMax);
+				squareMin *= std::min(std::max(weightMin, 0.0f), 1.0f);
+				squareMax *= std::min(std::max(weightMax, 0.0f), 1.0f);
+			}
+			signalMin = squareMin;
+			signalMax = squareMax;
+
+			float termMin, termMax;
+			FUNC(BoundsMul)(signalMin, signalMax, amp, amp, termMin, termMax);
+			minSum += termMin;
+			maxSum += termMax;
+			break;
+		}
+		case HybridMulti:
+		{
+			// (n + offset) * amp, after the first octave weighted by the product of the octaves before it clamped to 1
+			float termMin, termMax;
+			FUNC(BoundsMul)(octaveMin + m_fractalOffset, octaveMax + m_fractalOffset, amp, amp, termMin, termMax);
+
+			if (octave > 0)
+				FUNC(BoundsMul)(termMin, termMax, std::min(signalMin, 1.0f), std::min(signalMax, 1.0f), termMin, termMax);
+
+			// The weight for the next octave is this octave's term
+			signalMin = termMin;
+			signalMax = termMax;
+			minSum += termMin;
+			maxSum += termMax;
+			break;
+		}
+		case HeteroTerrain:
+		{
+			// n + offset, then each octave multiplies the height so far by 1 + (n + offset) * amp
+			if (octave == 0)
+			{
+				minSum = octaveMin + m_fractalOffset;
+				maxSum = octaveMax + m_fractalOffset;
+			}
+			else
+			{
+				float scaleMin, scaleMax;
+				FUNC(BoundsMul)(octaveMin + m_fractalOffset, octaveMax + m_fractalOffset, amp, amp, scaleMin, scaleMax);
+				FUNC(BoundsMul)(minSum, maxSum, 1.0f + scaleMin, 1.0f + scaleMax, minSum, maxSum);
+			}
+			break;
+		}
+		}
+		ampSum += amp;
+
+		// Next octave, matching the lacunarity scaling of the fractal set builders
+		amp *= m_gain;
+		xCenter *= m_lacunarity;
+		yCenter *= m_lacunarity;
+		zCenter *= m_lacunarity;
+		xHalf *= m_lacunarity;
+		yHalf *= m_lacunarity;
+		zHalf *= m_lacunarity;
+	}
+	SIMD_ZERO_ALL();
+
+	if (noiseType != m_noiseType && m_fractalType != RigidMulti)
+	{
+		minSum *= m_fractalBounding;
+		maxSum *= m_fractalBounding;
+		ampSum *= m_fractalBounding;
+	}
+
+	// Margin for the rounding of the fractal sums, multifractal octaves are also scaled by the octaves before them
+	float margin = ampSum * 1e-5f;
+
+	if (noiseType != m_noiseType && (m_fractalType == RigidMultiFeedback || m_fractalType == HybridMulti || m_fractalType == HeteroTerrain))
+		margin += std::max(std::abs(minSum), std::abs(maxSum)) * 1e-5f * octaves;
+
+	minOut = minSum - margin;
+	maxOut = maxSum + margin;
+	return true;
+}
+
+#ifdef FN_ALIGNED_SETS
+#define SIZE_MASK
+#define SAFE_LAST(f)
+#else
+#define SIZE_MASK & ~(VECTOR_SIZE - 1)
+#define SAFE_LAST(f)\
+if (loopMax != vectorSet->size)\
+{\
+	std::size_t remaining = (vectorSet->size - loopMax) * 4;\
+	\
+	SIMDf xF = SIMDf_LOAD(&vectorSet->xSet[loopMax]);\
+	SIMDf yF = SIMDf_LOAD(&vectorSet->ySet[loopMax]);\
+	SIMDf zF = SIMDf_LOAD(&vectorSet->zSet[loopMax]);\
+	\
+	xF = SIMDf_MUL_ADD(xF, xFreqV, xOffsetV);\
+	yF = SIMDf_MUL_ADD(yF, yFreqV, yOffsetV);\
+	zF = SIMDf_MUL_ADD(zF, zFreqV, zOffsetV);\
+	\
+	SIMDf result;\
+	f;\
+	result = SIMDf_POSITIVE_ZERO(result);\
+	std::memcpy(&noiseSet[index], &result, remaining);\
+}
+#endif
+
+#define VECTOR_SET_BUILDER(f)\
+while (index < loopMax)\
+{\
+	SIMDf xF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->xSet[index]), xFreqV, xOffsetV);\
+	SIMDf yF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->ySet[index]), yFreqV, yOffsetV);\
+	SIMDf zF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->zSet[index]), zFreqV, zOffsetV);\
+	\
+	PERTURB_SWITCH_ON(vectorSet->warped ? None : PERTURB_CASE())\
+	SIMDf result;\
+	f;\
+	result = SIMDf_POSITIVE_ZERO(result);\
+	SIMDf_STORE(&noiseSet[index], result);\
+	index += VECTOR_SIZE;\
+}\
+SAFE_LAST(f)
+
+#define FILL_VECTOR_SET(func)\
+void SIMD_LEVEL_CLASS::Fill##func##Set(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)\
+{\
+	assert(noiseSet);\
+	assert(vectorSet);\
+	assert(vectorSet->size >= 0);\
+	SIMD_ZERO_ALL();\
+	\
+	SIMDi seedV = SIMDi_SET(m_seed);\
+	SIMDf xFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_xScale);\
+	SIMDf yFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_yScale);\
+	SIMDf zFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_zScale);\
+	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);\
+	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
+	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
+	INIT_PERTURB_VALUES();\
+	\
+	int index = 0;\
+	int loopMax = vectorSet->size SIZE_MASK;\
+	\
+	VECTOR_SET_BUILDER(result = FUNC(func##Single)(seedV, xF, yF, zF))\
+	SIMD_ZERO_ALL();\
+}
+
+#define FILL_FRACTAL_VECTOR_SET(func)\
+void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)\
+{\
+	assert(noiseSet);\
+	assert(vectorSet);\
+	assert(vectorSet->size >= 0);\
+	SIMD_ZERO_ALL();\
+	\
+	SIMDi seedV = SIMDi_SET(m_seed);\
+	SIMDf lacunarityV = SIMDf_SET(m_lacunarity);\
+	SIMDf gainV = SIMDf_SET(m_gain);\
+	SIMDf fractalBoundingV = SIMDf_SET(m_fractalBounding);\
+	SIMDf fractalOffsetV = SIMDf_SET(m_fractalOffset);\
+	SIMDf fractalFeedbackV = SIMDf_SET(m_fractalFeedback);\
+	SIMDf xFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_xScale);\
+	SIMDf yFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_yScale);\
+	SIMDf zFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_zScale);\
+	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);\
+	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);\
+	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);\
+	INIT_PERTURB_VALUES();\
+	\
+	int index = 0;\
+	int loopMax = vectorSet->size SIZE_MASK;\
+	\
+	switch(m_fractalType)\
+	{\
+	case FBM:\
+		VECTOR_SET_BUILDER(FBM_SINGLE(func))\
+		break;\
 	case Billow:\
 		VECTOR_SET_BUILDER(BILLOW_SINGLE(func))\
 		break;\
 	case RigidMulti:\
 		VECTOR_SET_BUILDER(RIGIDMULTI_SINGLE(func))\
 		break;\
+	case RigidMultiFeedback:\
+		VECTOR_SET_BUILDER(RIGIDMULTIFEEDBACK_SINGLE(func))\
+		break;\
+	case HybridMulti:\
+		VECTOR_SET_BUILDER(HYBRIDMULTI_SINGLE(func))\
+		break;\
+	case HeteroTerrain:\
+		VECTOR_SET_BUILDER(HETEROTERRAIN_SINGLE(func))\
+		break;\
 	}\
 	SIMD_ZERO_ALL();\
 }
@@ -1496,74 +2968,98 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 	FILL_VECTOR_SET(Cubic)
 	FILL_FRACTAL_VECTOR_SET(Cubic)
 
-	void SIMD_LEVEL_CLASS::FillWhiteNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+// Set builder on integer coordinates, frequency and perturb are not applied
+// xP, yP, zP are the lattice coordinates multiplied by their primes, ready for hashing
+#define INT_SET_BUILDER(_set, _value)\
+if ((zSize & (VECTOR_SIZE - 1)) == 0)\
+{\
+	SIMDi xP = SIMDi_MUL(SIMDi_SET(xStart), SIMDi_NUM(xPrime));\
+	SIMDi yBase = SIMDi_MUL(SIMDi_SET(yStart), SIMDi_NUM(yPrime));\
+	SIMDi zBase = SIMDi_MUL(SIMDi_ADD(SIMDi_NUM(incremental), SIMDi_SET(zStart)), SIMDi_NUM(zPrime));\
+	\
+	SIMDi zStep = SIMDi_MUL(SIMDi_NUM(vectorSize), SIMDi_NUM(zPrime));\
+	\
+	int index = 0;\
+	\
+	for (int ix = 0; ix < xSize; ix++)\
+	{\
+		SIMDi yP = yBase;\
+		\
+		for (int iy = 0; iy < ySize; iy++)\
+		{\
+			SIMDi zP = zBase;\
+			\
+			SIMDf_STORE(&(_set)[index], _value);\
+			\
+			int iz = VECTOR_SIZE;\
+			while (iz < zSize)\
+			{\
+				zP = SIMDi_ADD(zP, zStep);\
+				index += VECTOR_SIZE;\
+				iz += VECTOR_SIZE;\
+				\
+				SIMDf_STORE(&(_set)[index], _value);\
+			}\
+			index += VECTOR_SIZE;\
+			yP = SIMDi_ADD(yP, SIMDi_NUM(yPrime));\
+		}\
+		xP = SIMDi_ADD(xP, SIMDi_NUM(xPrime));\
+	}\
+}\
+else\
+{\
+	SIMDi ySizeV = SIMDi_SET(ySize);\
+	SIMDi zSizeV = SIMDi_SET(zSize);\
+	\
+	SIMDi yEndV = SIMDi_SET(yStart + ySize - 1);\
+	SIMDi zEndV = SIMDi_SET(zStart + zSize - 1);\
+	\
+	SIMDi x = SIMDi_SET(xStart);\
+	SIMDi y = SIMDi_SET(yStart);\
+	SIMDi z = SIMDi_ADD(SIMDi_SET(zStart), SIMDi_NUM(incremental));\
+	AXIS_RESET(zSize, 1);\
+	\
+	int index = 0;\
+	int maxIndex = xSize * ySize * zSize;\
+	\
+	for (; index < maxIndex - VECTOR_SIZE; index += VECTOR_SIZE)\
+	{\
+		SIMDi xP = SIMDi_MUL(x, SIMDi_NUM(xPrime));\
+		SIMDi yP = SIMDi_MUL(y, SIMDi_NUM(yPrime));\
+		SIMDi zP = SIMDi_MUL(z, SIMDi_NUM(zPrime));\
+		SIMDf_STORE(&(_set)[index], _value);\
+		\
+		z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));\
+		\
+		AXIS_RESET(zSize, 0);\
+	}\
+	SIMDi xP = SIMDi_MUL(x, SIMDi_NUM(xPrime));\
+	SIMDi yP = SIMDi_MUL(y, SIMDi_NUM(yPrime));\
+	SIMDi zP = SIMDi_MUL(z, SIMDi_NUM(zPrime));\
+	SIMDf result = _value;\
+	STORE_LAST_RESULT(&(_set)[index], result);\
+}
+
+void SIMD_LEVEL_CLASS::FillWhiteNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
 {
 	assert(noiseSet);
 	SIMD_ZERO_ALL();
 	SIMDi seedV = SIMDi_SET(m_seed);
 
-	if ((zSize & (VECTOR_SIZE - 1)) == 0)
-	{
-		SIMDi x = SIMDi_MUL(SIMDi_SET(xStart), SIMDi_NUM(xPrime));
-		SIMDi yBase = SIMDi_MUL(SIMDi_SET(yStart), SIMDi_NUM(yPrime));
-		SIMDi zBase = SIMDi_MUL(SIMDi_ADD(SIMDi_NUM(incremental), SIMDi_SET(zStart)), SIMDi_NUM(zPrime));
-
-		SIMDi zStep = SIMDi_MUL(SIMDi_NUM(vectorSize), SIMDi_NUM(zPrime));
-
-		int index = 0;
+	INT_SET_BUILDER(noiseSet, FUNC(ValCoord)(seedV, xP, yP, zP))
 
-		for (int ix = 0; ix < xSize; ix++)
-		{
-			SIMDi y = yBase;
-
-			for (int iy = 0; iy < ySize; iy++)
-			{
-				SIMDi z = zBase;
-
-				SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, x, y, z));
-
-				int iz = VECTOR_SIZE;
-				while (iz < zSize)
-				{
-					z = SIMDi_ADD(z, zStep);
-					index += VECTOR_SIZE;
-					iz += VECTOR_SIZE;
-
-					SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, x, y, z));
-				}
-				index += VECTOR_SIZE;
-				y = SIMDi_ADD(y, SIMDi_NUM(yPrime));
-			}
-			x = SIMDi_ADD(x, SIMDi_NUM(xPrime));
-		}
-	}
-	else
-	{
-		SIMDi ySizeV = SIMDi_SET(ySize);
-		SIMDi zSizeV = SIMDi_SET(zSize);
-
-		SIMDi yEndV = SIMDi_SET(yStart + ySize - 1);
-		SIMDi zEndV = SIMDi_SET(zStart + zSize - 1);
-
-		SIMDi x = SIMDi_SET(xStart);
-		SIMDi y = SIMDi_SET(yStart);
-		SIMDi z = SIMDi_ADD(SIMDi_SET(zStart), SIMDi_NUM(incremental));
-		AXIS_RESET(zSize, 1);
-
-		int index = 0;
-		int maxIndex = xSize * ySize * zSize;
+	SIMD_ZERO_ALL();
+}
 
-		for (; index < maxIndex - VECTOR_SIZE; index += VECTOR_SIZE)
-		{
-			SIMDf_STORE(&noiseSet[index], FUNC(ValCoord)(seedV, SIMDi_MUL(x, SIMDi_NUM(xPrime)), SIMDi_MUL(y, SIMDi_NUM(yPrime)), SIMDi_MUL(z, SIMDi_NUM(zPrime))));
+// Same hashes as FillWhiteNoiseSet, stored before the conversion to float
+void SIMD_LEVEL_CLASS::FillTileHashSet(int* hashSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize)
+{
+	assert(hashSet);
+	SIMD_ZERO_ALL();
+	SIMDi seedV = SIMDi_SET(m_seed);
 
-			z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));
+	INT_SET_BUILDER(reinterpret_cast<float*>(hashSet), SIMDf_CAST_TO_FLOAT(FUNC(HashHB)(seedV, xP, yP, zP)))
 
-			AXIS_RESET(zSize, 0);
-		}
-		SIMDf result = FUNC(ValCoord)(seedV, SIMDi_MUL(x, SIMDi_NUM(xPrime)), SIMDi_MUL(y, SIMDi_NUM(yPrime)), SIMDi_MUL(z, SIMDi_NUM(zPrime)));
-		STORE_LAST_RESULT(&noiseSet[index], result);
-	}
 	SIMD_ZERO_ALL();
 }
 
@@ -1577,6 +3073,58 @@ void SIMD_LEVEL_CLASS::Fill##func##FractalSet(float* noiseSet, FastNoiseVectorSe
 #define Distance2Mul_RETURN(_distance, _distance2) SIMDf_MUL(_distance, _distance2)
 #define Distance2Div_RETURN(_distance, _distance2) SIMDf_DIV(_distance, _distance2)
 
+// Lower bounds used to prune the cellular search. A cell's point is its corner offset by
+// cellJitter along a unit vector, so on each axis it's at least |corner| - cellJitter away.
+// The bound is widened by 1% to cover the SIMDf_INV_SQRT estimate on every level, plus a
+// little for rounding, so a pruned cell can never be the closest or tie with it.
+// Every distance function grows with each axis, so it gives the bound from these minimums.
+#define CELLULAR_AXIS_BOUNDS(_bound, _cf)\
+	SIMDf _bound[3];\
+	for (int i = 0; i < 3; i++)\
+		_bound[i] = SIMDf_MAX(SIMDf_SUB(SIMDf_ABS(SIMDf_ADD(_cf, SIMDf_SET(float(i)))), jitterBound), SIMDf_NUM(0));
+
+// Only the inner y and z loops are skipped with the minimum over the axis
+#define CELLULAR_AXIS_MIN(_bound)\
+	SIMDf _bound##Min = SIMDf_MIN(_bound[0], SIMDf_MIN(_bound[1], _bound[2]));
+
+#define CELLULAR_PRUNE_BOUNDS()\
+	SIMDf jitterBound = SIMDf_MUL_ADD(SIMDf_ABS(cellJitter), SIMDf_NUM(1_01), SIMDf_NUM(0_0001));\
+	CELLULAR_AXIS_BOUNDS(xBound, xcf)\
+	CELLULAR_AXIS_BOUNDS(yBound, ycfBase)\
+	CELLULAR_AXIS_BOUNDS(zBound, zcfBase)\
+	CELLULAR_AXIS_MIN(yBound)\
+	CELLULAR_AXIS_MIN(zBound)
+
+// True if no lane can find a closer point than _best past the lower bound _lb
+#define CELLULAR_PRUNE(_best, _lb) MASK_ALL(SIMDf_LESS_THAN(_best, _lb))
+
+#define CELLULAR_POINT(distanceFunc, _xc, _yc, _zc, _xcf, _ycf, _zcf)\
+	SIMDi hash = FUNC(HashHB)(seed, _xc, _yc, _zc);\
+	SIMDf xd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
+	SIMDf yd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
+	SIMDf zd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,20), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
+	\
+	SIMDf invMag = SIMDf_MUL(cellJitter, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xd, xd, SIMDf_MUL_ADD(yd, yd, SIMDf_MUL(zd, zd)))));\
+	\
+	xd = SIMDf_MUL_ADD(xd, invMag, _xcf);\
+	yd = SIMDf_MUL_ADD(yd, invMag, _ycf);\
+	zd = SIMDf_MUL_ADD(zd, invMag, _zcf);\
+	\
+	SIMDf newDistance = distanceFunc##_DISTANCE(xd, yd, zd);
+
+// The centre cell is evaluated first to seed the pruning bound, then cells are visited in the
+// original order so ties resolve to the same cell as the full search
+// _keep runs inside the centre cell's scope, to copy out its hash where it's needed
+#define CELLULAR_CENTRE_POINT(distanceFunc, _keep)\
+	SIMDf centreDistance;\
+	{\
+		SIMDf one = SIMDf_NUM(1);\
+		CELLULAR_POINT(distanceFunc, SIMDi_ADD(xc, SIMDi_NUM(xPrime)), SIMDi_ADD(ycBase, SIMDi_NUM(yPrime)), SIMDi_ADD(zcBase, SIMDi_NUM(zPrime)),\
+			SIMDf_ADD(xcf, one), SIMDf_ADD(ycfBase, one), SIMDf_ADD(zcfBase, one))\
+		centreDistance = newDistance;\
+		_keep;\
+	}
+
 #define CELLULAR_VALUE_SINGLE(distanceFunc)\
 static SIMDf VECTORCALL FUNC(CellularValue##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, SIMDf cellJitter)\
 {\
@@ -1595,37 +3143,44 @@ static SIMDf VECTORCALL FUNC(CellularValue##distanceFunc##Single)(SIMDi seed, SI
 	ycBase = SIMDi_MUL(ycBase, SIMDi_NUM(yPrime));\
 	zcBase = SIMDi_MUL(zcBase, SIMDi_NUM(zPrime));\
 	\
+	CELLULAR_PRUNE_BOUNDS()\
+	SIMDi centreHash;\
+	CELLULAR_CENTRE_POINT(distanceFunc, centreHash = hash)\
+	\
 	for (int xi = 0; xi < 3; xi++)\
 	{\
 		SIMDf ycf = ycfBase;\
 		SIMDi yc = ycBase;\
-		for (int yi = 0; yi < 3; yi++)\
+		SIMDf xLB = distanceFunc##_DISTANCE(xBound[xi], yBoundMin, zBoundMin);\
+		for (int yi = 0; yi < 3 && !CELLULAR_PRUNE(SIMDf_MIN(distance, centreDistance), xLB); yi++)\
 		{\
 			SIMDf zcf = zcfBase;\
 			SIMDi zc = zcBase;\
-			for (int zi = 0; zi < 3; zi++)\
+			if (!CELLULAR_PRUNE(SIMDf_MIN(distance, centreDistance), distanceFunc##_DISTANCE(xBound[xi], yBound[yi], zBoundMin)))\
 			{\
-				SIMDi hash = FUNC(HashHB)(seed, xc, yc, zc);\
-				SIMDf xd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf yd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf zd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,20), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				\
-				SIMDf invMag = SIMDf_MUL(cellJitter, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xd, xd, SIMDf_MUL_ADD(yd, yd, SIMDf_MUL(zd, zd)))));\
-				\
-				xd = SIMDf_MUL_ADD(xd, invMag, xcf);\
-				yd = SIMDf_MUL_ADD(yd, invMag, ycf);\
-				zd = SIMDf_MUL_ADD(zd, invMag, zcf);\
-				\
-				SIMDf newCellValue = SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(hash));\
-				SIMDf newDistance = distanceFunc##_DISTANCE(xd, yd, zd);\
-				\
-				MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
-				\
-				distance = SIMDf_MIN(newDistance, distance);\
-				cellValue = SIMDf_BLENDV(cellValue, newCellValue, closer);\
-				\
-				zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
-				zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+				for (int zi = 0; zi < 3; zi++)\
+				{\
+					if (xi == 1 && yi == 1 && zi == 1)\
+					{\
+						MASK closer = SIMDf_LESS_THAN(centreDistance, distance);\
+						\
+						distance = SIMDf_MIN(centreDistance, distance);\
+						cellValue = SIMDf_BLENDV(cellValue, SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(centreHash)), closer);\
+					}\
+					else if (!CELLULAR_PRUNE(SIMDf_MIN(distance, centreDistance), distanceFunc##_DISTANCE(xBound[xi], yBound[yi], zBound[zi])))\
+					{\
+						CELLULAR_POINT(distanceFunc, xc, yc, zc, xcf, ycf, zcf)\
+						\
+						SIMDf newCellValue = SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(hash));\
+						\
+						MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
+						\
+						distance = SIMDf_MIN(newDistance, distance);\
+						cellValue = SIMDf_BLENDV(cellValue, newCellValue, closer);\
+					}\
+					zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+					zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+				}\
 			}\
 			ycf = SIMDf_ADD(ycf, SIMDf_NUM(1));\
 			yc = SIMDi_ADD(yc, SIMDi_NUM(yPrime));\
@@ -1637,6 +3192,39 @@ static SIMDf VECTORCALL FUNC(CellularValue##distanceFunc##Single)(SIMDi seed, SI
 	return cellValue;\
 }
 
+// Direct mapped table of lookup values keyed on the bits of the lookup position
+// Only lives for one fill, so the settings can't change under it
+struct NoiseLookupCache
+{
+	static const int SIZE = 256;
+	// Vectors checked before deciding if the cache is worth keeping for the rest of the fill
+	static const int SAMPLE_VECTORS = 256;
+
+	int x[SIZE];
+	int y[SIZE];
+	int z[SIZE];
+	float value[SIZE];
+
+	int vectors;
+	int missVectors;
+	bool bypass;
+
+	void Clear()
+	{
+		std::memset(x, 0xFF, sizeof(x));
+		std::memset(y, 0xFF, sizeof(y));
+		std::memset(z, 0xFF, sizeof(z));
+		vectors = 0;
+		missVectors = 0;
+		bypass = false;
+	}
+
+	static int Slot(int xKey, int yKey, int zKey)
+	{
+		return (int)(((unsigned)xKey * 0x9E3779B1u ^ (unsigned)yKey * 0x85EBCA77u ^ (unsigned)zKey * 0xC2B2AE3Du) >> 24);
+	}
+};
+
 struct NoiseLookupSettings
 {
 	_FastNoiseSIMD::NoiseType type;
@@ -1646,12 +3234,17 @@ struct NoiseLookupSettings
 	SIMDf fractalLacunarity;
 	SIMDf fractalGain;
 	SIMDf fractalBounding;
+	SIMDf fractalOffset;
+	SIMDf fractalFeedback;
+	NoiseLookupCache* cache;
 };
 
 #define CELLULAR_LOOKUP_FRACTAL_VALUE(noiseType){\
 SIMDf lacunarityV = noiseLookupSettings.fractalLacunarity;\
 SIMDf gainV = noiseLookupSettings.fractalGain;\
 SIMDf fractalBoundingV = noiseLookupSettings.fractalBounding;\
+SIMDf fractalOffsetV = noiseLookupSettings.fractalOffset;\
+SIMDf fractalFeedbackV = noiseLookupSettings.fractalFeedback;\
 int m_octaves = noiseLookupSettings.fractalOctaves;\
 switch(noiseLookupSettings.fractalType)\
 {\
@@ -1664,120 +3257,162 @@ switch(noiseLookupSettings.fractalType)\
 	case _FastNoiseSIMD::RigidMulti:\
 		{RIGIDMULTI_SINGLE(noiseType);}\
 		break;\
-}}\
-
-#ifdef SIMPLEX_ENABLED
-#define CELLULAR_LOOKUP_SINGLE(distanceFunc)\
-static SIMDf VECTORCALL FUNC(CellularLookup##distanceFunc##Single)(SIMDi seedV, SIMDf x, SIMDf y, SIMDf z, SIMDf cellJitter, const NoiseLookupSettings& noiseLookupSettings)\
-{\
-	SIMDf distance = SIMDf_NUM(999999);\
-	SIMDf xCell = SIMDf_UNDEFINED();\
-	SIMDf yCell = SIMDf_UNDEFINED();\
-	SIMDf zCell = SIMDf_UNDEFINED();\
-	\
-	SIMDi xc     = SIMDi_SUB(SIMDi_CONVERT_TO_INT(x), SIMDi_NUM(1));\
-	SIMDi ycBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(y), SIMDi_NUM(1));\
-	SIMDi zcBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(z), SIMDi_NUM(1));\
-	\
-	SIMDf xcf     = SIMDf_CONVERT_TO_FLOAT(xc);\
-	SIMDf ycfBase = SIMDf_CONVERT_TO_FLOAT(ycBase);\
-	SIMDf zcfBase = SIMDf_CONVERT_TO_FLOAT(zcBase);\
-	\
-	xc     = SIMDi_MUL(xc, SIMDi_NUM(xPrime));\
-	ycBase = SIMDi_MUL(ycBase, SIMDi_NUM(yPrime));\
-	zcBase = SIMDi_MUL(zcBase, SIMDi_NUM(zPrime));\
-	\
-	for (int xi = 0; xi < 3; xi++)\
-	{\
-		SIMDf ycf = ycfBase;\
-		SIMDi yc = ycBase;\
-		SIMDf xLocal = SIMDf_SUB(xcf, x);\
-		for (int yi = 0; yi < 3; yi++)\
-		{\
-			SIMDf zcf = zcfBase;\
-			SIMDi zc = zcBase;\
-			SIMDf yLocal = SIMDf_SUB(ycf, y);\
-			for (int zi = 0; zi < 3; zi++)\
-			{\
-				SIMDf zLocal = SIMDf_SUB(zcf, z);\
-				\
-				SIMDi hash = FUNC(HashHB)(seedV, xc, yc, zc);\
-				SIMDf xd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf yd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf zd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,20), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				\
-				SIMDf invMag = SIMDf_MUL(cellJitter, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xd, xd, SIMDf_MUL_ADD(yd, yd, SIMDf_MUL(zd, zd)))));\
-				\
-				SIMDf xCellNew = SIMDf_MUL(xd, invMag);\
-				SIMDf yCellNew = SIMDf_MUL(yd, invMag);\
-				SIMDf zCellNew = SIMDf_MUL(zd, invMag);\
-				\
-				xd = SIMDf_ADD(xCellNew, xLocal);\
-				yd = SIMDf_ADD(yCellNew, yLocal);\
-				zd = SIMDf_ADD(zCellNew, zLocal);\
-				\
-				xCellNew = SIMDf_ADD(xCellNew, xcf); \
-				yCellNew = SIMDf_ADD(yCellNew, ycf); \
-				zCellNew = SIMDf_ADD(zCellNew, zcf); \
-				\
-				SIMDf newDistance = distanceFunc##_DISTANCE(xd, yd, zd);\
-				\
-				MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
-				\
-				distance = SIMDf_MIN(newDistance, distance);\
-				xCell = SIMDf_BLENDV(xCell, xCellNew, closer);\
-				yCell = SIMDf_BLENDV(yCell, yCellNew, closer);\
-				zCell = SIMDf_BLENDV(zCell, zCellNew, closer);\
-				\
-				zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
-				zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
-			}\
-			ycf = SIMDf_ADD(ycf, SIMDf_NUM(1));\
-			yc = SIMDi_ADD(yc, SIMDi_NUM(yPrime));\
-		}\
-		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
-		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
-	}\
-	\
-	SIMDf xF = SIMDf_MUL(xCell, noiseLookupSettings.frequency);\
-	SIMDf yF = SIMDf_MUL(yCell, noiseLookupSettings.frequency);\
-	SIMDf zF = SIMDf_MUL(zCell, noiseLookupSettings.frequency);\
-	SIMDf result;\
-	\
-	switch(noiseLookupSettings.type)\
-	{\
-	default:\
-		break;\
-	case _FastNoiseSIMD::Value:\
-		result = FUNC(ValueSingle)(seedV, xF, yF, zF); \
-		break;\
-	case _FastNoiseSIMD::ValueFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Value);\
-		break; \
-	case _FastNoiseSIMD::Perlin:\
-		result = FUNC(PerlinSingle)(seedV, xF, yF, zF); \
+	case _FastNoiseSIMD::RigidMultiFeedback:\
+		{RIGIDMULTIFEEDBACK_SINGLE(noiseType);}\
 		break;\
-	case _FastNoiseSIMD::PerlinFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Perlin);\
-		break; \
-	case _FastNoiseSIMD::Simplex:\
-		result = FUNC(SimplexSingle)(seedV, xF, yF, zF); \
+	case _FastNoiseSIMD::HybridMulti:\
+		{HYBRIDMULTI_SINGLE(noiseType);}\
 		break;\
-	case _FastNoiseSIMD::SimplexFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Simplex);\
-		break; \
-	case _FastNoiseSIMD::Cubic:\
-		result = FUNC(CubicSingle)(seedV, xF, yF, zF); \
+	case _FastNoiseSIMD::HeteroTerrain:\
+		{HETEROTERRAIN_SINGLE(noiseType);}\
 		break;\
-	case _FastNoiseSIMD::CubicFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Cubic);\
-		break; \
-	}\
-	\
-	return result;\
+}}\
+
+static SIMDf VECTORCALL FUNC(CellularLookupNoise)(SIMDi seedV, SIMDf xF, SIMDf yF, SIMDf zF, const NoiseLookupSettings& noiseLookupSettings)
+{
+	SIMDf result;
+
+	switch (noiseLookupSettings.type)
+	{
+	default:
+		break;
+	case _FastNoiseSIMD::Value:
+		result = FUNC(ValueSingle)(seedV, xF, yF, zF);
+		break;
+	case _FastNoiseSIMD::ValueFractal:
+		CELLULAR_LOOKUP_FRACTAL_VALUE(Value);
+		break;
+	case _FastNoiseSIMD::Perlin:
+		result = FUNC(PerlinSingle)(seedV, xF, yF, zF);
+		break;
+	case _FastNoiseSIMD::PerlinFractal:
+		CELLULAR_LOOKUP_FRACTAL_VALUE(Perlin);
+		break;
+#ifdef SIMPLEX_ENABLED
+	case _FastNoiseSIMD::Simplex:
+		result = FUNC(SimplexSingle)(seedV, xF, yF, zF);
+		break;
+	case _FastNoiseSIMD::SimplexFractal:
+		CELLULAR_LOOKUP_FRACTAL_VALUE(Simplex);
+		break;
+#endif
+	case _FastNoiseSIMD::Cubic:
+		result = FUNC(CubicSingle)(seedV, xF, yF, zF);
+		break;
+	case _FastNoiseSIMD::CubicFractal:
+		CELLULAR_LOOKUP_FRACTAL_VALUE(Cubic);
+		break;
+	}
+
+	return result;
 }
 
-#else
+// Lanes in the same cell share a lookup position, so only positions missing from the cache are evaluated,
+// packed into a single vector, and the results are scattered back to every lane that needs them
+// Gives up for the rest of the fill if most vectors miss anyway, since a miss costs a full evaluation
+static SIMDf VECTORCALL FUNC(CellularLookupCachedNoise)(SIMDi seedV, SIMDf xF, SIMDf yF, SIMDf zF, const NoiseLookupSettings& noiseLookupSettings)
+{
+	NoiseLookupCache& cache = *noiseLookupSettings.cache;
+
+	if (cache.bypass)
+		return FUNC(CellularLookupNoise)(seedV, xF, yF, zF, noiseLookupSettings);
+
+	if (++cache.vectors == NoiseLookupCache::SAMPLE_VECTORS)
+	{
+		cache.bypass = cache.missVectors * 4 > NoiseLookupCache::SAMPLE_VECTORS * 3;
+		cache.vectors = 0;
+		cache.missVectors = 0;
+	}
+
+	uSIMDi xKey, yKey, zKey;
+	xKey.m = SIMDi_CAST_TO_INT(xF);
+	yKey.m = SIMDi_CAST_TO_INT(yF);
+	zKey.m = SIMDi_CAST_TO_INT(zF);
+
+	// Whole vector in one cell
+	if (MASK_ALL(MASK_AND(SIMDi_EQUAL(xKey.m, SIMDi_SET(xKey.a[0])), MASK_AND(SIMDi_EQUAL(yKey.m, SIMDi_SET(yKey.a[0])), SIMDi_EQUAL(zKey.m, SIMDi_SET(zKey.a[0]))))))
+	{
+		int s = NoiseLookupCache::Slot(xKey.a[0], yKey.a[0], zKey.a[0]);
+
+		if (cache.x[s] == xKey.a[0] && cache.y[s] == yKey.a[0] && cache.z[s] == zKey.a[0])
+			return SIMDf_SET(cache.value[s]);
+
+		uSIMDf uniformResult;
+		uniformResult.m = FUNC(CellularLookupNoise)(seedV, xF, yF, zF, noiseLookupSettings);
+		cache.value[s] = uniformResult.a[0];
+		cache.x[s] = xKey.a[0];
+		cache.y[s] = yKey.a[0];
+		cache.z[s] = zKey.a[0];
+		cache.missVectors++;
+		return uniformResult.m;
+	}
+
+	uSIMDf result;
+	uSIMDi xMiss, yMiss, zMiss;
+	int slot[VECTOR_SIZE];
+	int missIndex[VECTOR_SIZE];
+	int missCount = 0;
+
+	for (int i = 0; i < VECTOR_SIZE; i++)
+	{
+		int s = NoiseLookupCache::Slot(xKey.a[i], yKey.a[i], zKey.a[i]);
+		slot[i] = s;
+
+		if (cache.x[s] == xKey.a[i] && cache.y[s] == yKey.a[i] && cache.z[s] == zKey.a[i])
+		{
+			result.a[i] = cache.value[s];
+			missIndex[i] = -1;
+			continue;
+		}
+
+		int m = 0;
+		while (m < missCount && (xMiss.a[m] != xKey.a[i] || yMiss.a[m] != yKey.a[i] || zMiss.a[m] != zKey.a[i]))
+			m++;
+
+		if (m == missCount)
+		{
+			xMiss.a[m] = xKey.a[i];
+			yMiss.a[m] = yKey.a[i];
+			zMiss.a[m] = zKey.a[i];
+			missCount++;
+		}
+		missIndex[i] = m;
+	}
+
+	if (missCount == 0)
+		return result.m;
+
+	cache.missVectors++;
+
+	for (int m = missCount; m < VECTOR_SIZE; m++)
+	{
+		xMiss.a[m] = xMiss.a[0];
+		yMiss.a[m] = yMiss.a[0];
+		zMiss.a[m] = zMiss.a[0];
+	}
+
+	uSIMDf missResult;
+	missResult.m = FUNC(CellularLookupNoise)(seedV, SIMDf_CAST_TO_FLOAT(xMiss.m), SIMDf_CAST_TO_FLOAT(yMiss.m), SIMDf_CAST_TO_FLOAT(zMiss.m), noiseLookupSettings);
+
+	for (int i = 0; i < VECTOR_SIZE; i++)
+	{
+		if (missIndex[i] < 0)
+			continue;
+
+		int s = slot[i];
+		result.a[i] = cache.value[s] = missResult.a[missIndex[i]];
+		cache.x[s] = xKey.a[i];
+		cache.y[s] = yKey.a[i];
+		cache.z[s] = zKey.a[i];
+	}
+
+	return result.m;
+}
+
+#define CELLULAR_LOOKUP_NOISE(_seed, _x, _y, _z)\
+(noiseLookupSettings.cache ?\
+	FUNC(CellularLookupCachedNoise)(_seed, _x, _y, _z, noiseLookupSettings) :\
+	FUNC(CellularLookupNoise)(_seed, _x, _y, _z, noiseLookupSettings))
 
 #define CELLULAR_LOOKUP_SINGLE(distanceFunc)\
 static SIMDf VECTORCALL FUNC(CellularLookup##distanceFunc##Single)(SIMDi seedV, SIMDf x, SIMDf y, SIMDf z, SIMDf cellJitter, const NoiseLookupSettings& noiseLookupSettings)\
@@ -1851,45 +3486,12 @@ static SIMDf VECTORCALL FUNC(CellularLookup##distanceFunc##Single)(SIMDi seedV,
 		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
 	}\
 	\
-	SIMDf xF = SIMDf_MUL(xCell, noiseLookupSettings.frequency);\
-	SIMDf yF = SIMDf_MUL(yCell, noiseLookupSettings.frequency);\
-	SIMDf zF = SIMDf_MUL(zCell, noiseLookupSettings.frequency);\
-	SIMDf result;\
-	\
-	switch(noiseLookupSettings.type)\
-	{\
-	default:\
-		break;\
-	case _FastNoiseSIMD::Value:\
-		result = FUNC(ValueSingle)(seedV, xF, yF, zF); \
-		break;\
-	case _FastNoiseSIMD::ValueFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Value);\
-		break; \
-	case _FastNoiseSIMD::Perlin:\
-		result = FUNC(PerlinSingle)(seedV, xF, yF, zF); \
-		break;\
-	case _FastNoiseSIMD::PerlinFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Perlin);\
-		break; \
-	case _FastNoiseSIMD::Cubic:\
-		result = FUNC(CubicSingle)(seedV, xF, yF, zF); \
-		break;\
-	case _FastNoiseSIMD::CubicFractal:\
-		CELLULAR_LOOKUP_FRACTAL_VALUE(Cubic);\
-		break; \
-	}\
-	\
-	return result;\
+	return CELLULAR_LOOKUP_NOISE(seedV, SIMDf_MUL(xCell, noiseLookupSettings.frequency), SIMDf_MUL(yCell, noiseLookupSettings.frequency), SIMDf_MUL(zCell, noiseLookupSettings.frequency));\
 }
 
-#endif	// SIMPLEX_ENABLED
-
 #define CELLULAR_DISTANCE_SINGLE(distanceFunc)\
 static SIMDf VECTORCALL FUNC(CellularDistance##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, SIMDf cellJitter)\
 {\
-	SIMDf distance = SIMDf_NUM(999999);\
-	\
 	SIMDi xc     = SIMDi_SUB(SIMDi_CONVERT_TO_INT(x), SIMDi_NUM(1));\
 	SIMDi ycBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(y), SIMDi_NUM(1));\
 	SIMDi zcBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(z), SIMDi_NUM(1));\
@@ -1902,33 +3504,32 @@ static SIMDf VECTORCALL FUNC(CellularDistance##distanceFunc##Single)(SIMDi seed,
 	ycBase = SIMDi_MUL(ycBase, SIMDi_NUM(yPrime));\
 	zcBase = SIMDi_MUL(zcBase, SIMDi_NUM(zPrime));\
 	\
-	for (int xi = 0; xi < 3; xi++)\
-	{\
-		SIMDf ycf = ycfBase;\
-		SIMDi yc = ycBase;\
-		for (int yi = 0; yi < 3; yi++)\
-		{\
-			SIMDf zcf = zcfBase;\
-			SIMDi zc = zcBase;\
-			for (int zi = 0; zi < 3; zi++)\
-			{\
-				SIMDi hash = FUNC(HashHB)(seed, xc, yc, zc);\
-				SIMDf xd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf yd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				SIMDf zd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,20), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
-				\
-				SIMDf invMag = SIMDf_MUL(cellJitter, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xd, xd, SIMDf_MUL_ADD(yd, yd, SIMDf_MUL(zd, zd)))));\
-				\
-				xd = SIMDf_MUL_ADD(xd, invMag, xcf);\
-				yd = SIMDf_MUL_ADD(yd, invMag, ycf);\
-				zd = SIMDf_MUL_ADD(zd, invMag, zcf);\
-				\
-				SIMDf newDistance = distanceFunc##_DISTANCE(xd, yd, zd);\
-				\
-				distance = SIMDf_MIN(distance, newDistance);\
-				\
-				zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
-				zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+	CELLULAR_PRUNE_BOUNDS()\
+	CELLULAR_CENTRE_POINT(distanceFunc, )\
+	SIMDf distance = centreDistance;\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf ycf = ycfBase;\
+		SIMDi yc = ycBase;\
+		SIMDf xLB = distanceFunc##_DISTANCE(xBound[xi], yBoundMin, zBoundMin);\
+		for (int yi = 0; yi < 3 && !CELLULAR_PRUNE(distance, xLB); yi++)\
+		{\
+			SIMDf zcf = zcfBase;\
+			SIMDi zc = zcBase;\
+			if (!CELLULAR_PRUNE(distance, distanceFunc##_DISTANCE(xBound[xi], yBound[yi], zBoundMin)))\
+			{\
+				for (int zi = 0; zi < 3; zi++)\
+				{\
+					if ((xi != 1 || yi != 1 || zi != 1) && !CELLULAR_PRUNE(distance, distanceFunc##_DISTANCE(xBound[xi], yBound[yi], zBound[zi])))\
+					{\
+						CELLULAR_POINT(distanceFunc, xc, yc, zc, xcf, ycf, zcf)\
+						\
+						distance = SIMDf_MIN(distance, newDistance);\
+					}\
+					zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+					zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+				}\
 			}\
 			ycf = SIMDf_ADD(ycf, SIMDf_NUM(1));\
 			yc = SIMDi_ADD(yc, SIMDi_NUM(yPrime));\
@@ -2012,6 +3613,244 @@ static SIMDf VECTORCALL FUNC(CellularDistance2Cave##distanceFunc##Single)(SIMDi
 	return SIMDf_MIN(c0,c1);\
 }
 
+// 2D cellular, in the X/Z plane. Cell points are jittered in 2D from the first 20 bits of the
+// hash, so only the 3x3 neighbourhood is searched
+#define Euclidean_DISTANCE_2D(_x, _z) SIMDf_MUL_ADD(_x, _x, SIMDf_MUL(_z, _z))
+#define Manhattan_DISTANCE_2D(_x, _z) SIMDf_ADD(SIMDf_ABS(_x), SIMDf_ABS(_z))
+#define Natural_DISTANCE_2D(_x, _z) SIMDf_ADD(Euclidean_DISTANCE_2D(_x,_z), Manhattan_DISTANCE_2D(_x,_z))
+
+#define CELLULAR_2D_INIT()\
+	SIMDi xc     = SIMDi_SUB(SIMDi_CONVERT_TO_INT(x), SIMDi_NUM(1));\
+	SIMDi zcBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(z), SIMDi_NUM(1));\
+	\
+	SIMDf xcf     = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(xc), x);\
+	SIMDf zcfBase = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(zcBase), z);\
+	\
+	xc     = SIMDi_MUL(xc, SIMDi_NUM(xPrime));\
+	zcBase = SIMDi_MUL(zcBase, SIMDi_NUM(zPrime));
+
+#define CELLULAR_2D_POINT()\
+	SIMDi hash = FUNC(HashHB)(seed, xc, SIMDi_SET_ZERO(), zc);\
+	SIMDf xd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(hash, SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
+	SIMDf zd = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(SIMDi_AND(SIMDi_SHIFT_R(hash,10), SIMDi_NUM(bit10Mask))), SIMDf_NUM(511_5));\
+	\
+	SIMDf invMag = SIMDf_MUL(cellJitter, SIMDf_INV_SQRT(SIMDf_MUL_ADD(xd, xd, SIMDf_MUL(zd, zd))));\
+	\
+	xd = SIMDf_MUL(xd, invMag);\
+	zd = SIMDf_MUL(zd, invMag);
+
+#define CELLULAR_VALUE_2D_SINGLE(distanceFunc)\
+static SIMDf VECTORCALL FUNC(CellularValue2D##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf z, SIMDf cellJitter)\
+{\
+	SIMDf distance = SIMDf_NUM(999999);\
+	SIMDf cellValue = SIMDf_UNDEFINED();\
+	\
+	CELLULAR_2D_INIT()\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf zcf = zcfBase;\
+		SIMDi zc = zcBase;\
+		for (int zi = 0; zi < 3; zi++)\
+		{\
+			CELLULAR_2D_POINT()\
+			\
+			SIMDf newCellValue = SIMDf_MUL(SIMDf_NUM(hash2Float), SIMDf_CONVERT_TO_FLOAT(hash));\
+			SIMDf newDistance = distanceFunc##_DISTANCE_2D(SIMDf_ADD(xd, xcf), SIMDf_ADD(zd, zcf));\
+			\
+			MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
+			\
+			distance = SIMDf_MIN(newDistance, distance);\
+			cellValue = SIMDf_BLENDV(cellValue, newCellValue, closer);\
+			\
+			zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+			zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+		}\
+		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
+		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
+	}\
+	\
+	return cellValue;\
+}
+
+// The lookup noise is sampled at the closest cell's point, on the y = 0 plane
+#define CELLULAR_LOOKUP_2D_SINGLE(distanceFunc)\
+static SIMDf VECTORCALL FUNC(CellularLookup2D##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf z, SIMDf cellJitter, const NoiseLookupSettings& noiseLookupSettings)\
+{\
+	SIMDf distance = SIMDf_NUM(999999);\
+	SIMDf xCell = SIMDf_UNDEFINED();\
+	SIMDf zCell = SIMDf_UNDEFINED();\
+	\
+	CELLULAR_2D_INIT()\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf zcf = zcfBase;\
+		SIMDi zc = zcBase;\
+		for (int zi = 0; zi < 3; zi++)\
+		{\
+			CELLULAR_2D_POINT()\
+			\
+			xd = SIMDf_ADD(xd, xcf);\
+			zd = SIMDf_ADD(zd, zcf);\
+			\
+			SIMDf newDistance = distanceFunc##_DISTANCE_2D(xd, zd);\
+			\
+			MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
+			\
+			distance = SIMDf_MIN(newDistance, distance);\
+			xCell = SIMDf_BLENDV(xCell, SIMDf_ADD(xd, x), closer);\
+			zCell = SIMDf_BLENDV(zCell, SIMDf_ADD(zd, z), closer);\
+			\
+			zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+			zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+		}\
+		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
+		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
+	}\
+	\
+	return CELLULAR_LOOKUP_NOISE(seed, SIMDf_MUL(xCell, noiseLookupSettings.frequency), SIMDf_NUM(0), SIMDf_MUL(zCell, noiseLookupSettings.frequency));\
+}
+
+#define CELLULAR_DISTANCE_2D_SINGLE(distanceFunc)\
+static SIMDf VECTORCALL FUNC(CellularDistance2D##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf z, SIMDf cellJitter)\
+{\
+	SIMDf distance = SIMDf_NUM(999999);\
+	\
+	CELLULAR_2D_INIT()\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf zcf = zcfBase;\
+		SIMDi zc = zcBase;\
+		for (int zi = 0; zi < 3; zi++)\
+		{\
+			CELLULAR_2D_POINT()\
+			\
+			SIMDf newDistance = distanceFunc##_DISTANCE_2D(SIMDf_ADD(xd, xcf), SIMDf_ADD(zd, zcf));\
+			\
+			distance = SIMDf_MIN(distance, newDistance);\
+			\
+			zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+			zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+		}\
+		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
+		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
+	}\
+	\
+	return distance;\
+}
+
+#define CELLULAR_DISTANCE2_2D_SINGLE(distanceFunc, returnFunc)\
+static SIMDf VECTORCALL FUNC(Cellular##returnFunc##2D##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf z, SIMDf cellJitter, int index0, int index1)\
+{\
+	SIMDf distance[FN_CELLULAR_INDEX_MAX+1] = {SIMDf_NUM(999999),SIMDf_NUM(999999),SIMDf_NUM(999999),SIMDf_NUM(999999)};\
+	\
+	CELLULAR_2D_INIT()\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf zcf = zcfBase;\
+		SIMDi zc = zcBase;\
+		for (int zi = 0; zi < 3; zi++)\
+		{\
+			CELLULAR_2D_POINT()\
+			\
+			SIMDf newDistance = distanceFunc##_DISTANCE_2D(SIMDf_ADD(xd, xcf), SIMDf_ADD(zd, zcf));\
+			\
+			for(int i = index1; i > 0; i--)\
+				distance[i] = SIMDf_MAX(SIMDf_MIN(distance[i], newDistance), distance[i-1]);\
+			distance[0] = SIMDf_MIN(distance[0], newDistance);\
+			\
+			zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+			zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+		}\
+		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
+		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
+	}\
+	\
+	return returnFunc##_RETURN(distance[index0], distance[index1]);\
+}
+
+#define CELLULAR_DISTANCE2CAVE_2D_SINGLE(distanceFunc)\
+static SIMDf VECTORCALL FUNC(CellularDistance2Cave2D##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf z, SIMDf cellJitter, int index0, int index1)\
+{\
+	SIMDf c0 = FUNC(CellularDistance2Div2D##distanceFunc##Single)(seed, x, z, cellJitter, index0, index1);\
+	\
+	x = SIMDf_ADD(x, SIMDf_NUM(0_5));\
+	z = SIMDf_ADD(z, SIMDf_NUM(0_5));\
+	seed = SIMDi_ADD(seed, SIMDi_NUM(1));\
+	\
+	SIMDf c1 = FUNC(CellularDistance2Div2D##distanceFunc##Single)(seed, x, z, cellJitter, index0, index1);\
+	\
+	return SIMDf_MIN(c0,c1);\
+}
+
+// Closest cell's hash, plus the closest and second closest cell points in noise coordinates
+// Distances come from CELLULAR_POINT like CellValue, so both pick the same cell, the points get x added back after
+#define CELLULAR_CELL_SINGLE(distanceFunc)\
+static void VECTORCALL FUNC(CellularCell##distanceFunc##Single)(SIMDi seed, SIMDf x, SIMDf y, SIMDf z, SIMDf cellJitter, SIMDi& cellOut, SIMDf* pointOut, SIMDf* point2Out)\
+{\
+	SIMDf distance = SIMDf_NUM(999999);\
+	SIMDf distance2 = SIMDf_NUM(999999);\
+	SIMDf cell = SIMDf_UNDEFINED();\
+	for (int i = 0; i < 3; i++)\
+		pointOut[i] = point2Out[i] = SIMDf_UNDEFINED();\
+	\
+	SIMDi xc     = SIMDi_SUB(SIMDi_CONVERT_TO_INT(x), SIMDi_NUM(1));\
+	SIMDi ycBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(y), SIMDi_NUM(1));\
+	SIMDi zcBase = SIMDi_SUB(SIMDi_CONVERT_TO_INT(z), SIMDi_NUM(1));\
+	\
+	SIMDf xcf     = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(xc), x);\
+	SIMDf ycfBase = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(ycBase), y);\
+	SIMDf zcfBase = SIMDf_SUB(SIMDf_CONVERT_TO_FLOAT(zcBase), z);\
+	\
+	xc     = SIMDi_MUL(xc, SIMDi_NUM(xPrime));\
+	ycBase = SIMDi_MUL(ycBase, SIMDi_NUM(yPrime));\
+	zcBase = SIMDi_MUL(zcBase, SIMDi_NUM(zPrime));\
+	\
+	for (int xi = 0; xi < 3; xi++)\
+	{\
+		SIMDf ycf = ycfBase;\
+		SIMDi yc = ycBase;\
+		for (int yi = 0; yi < 3; yi++)\
+		{\
+			SIMDf zcf = zcfBase;\
+			SIMDi zc = zcBase;\
+			for (int zi = 0; zi < 3; zi++)\
+			{\
+				CELLULAR_POINT(distanceFunc, xc, yc, zc, xcf, ycf, zcf)\
+				\
+				SIMDf point[3];\
+				point[0] = SIMDf_ADD(xd, x);\
+				point[1] = SIMDf_ADD(yd, y);\
+				point[2] = SIMDf_ADD(zd, z);\
+				\
+				MASK closer = SIMDf_LESS_THAN(newDistance, distance);\
+				MASK closer2 = SIMDf_LESS_THAN(newDistance, distance2);\
+				\
+				for (int i = 0; i < 3; i++)\
+				{\
+					point2Out[i] = SIMDf_BLENDV(point2Out[i], SIMDf_BLENDV(point[i], pointOut[i], closer), closer2);\
+					pointOut[i] = SIMDf_BLENDV(pointOut[i], point[i], closer);\
+				}\
+				distance2 = SIMDf_MAX(SIMDf_MIN(distance2, newDistance), distance);\
+				distance = SIMDf_MIN(distance, newDistance);\
+				cell = SIMDf_BLENDV(cell, SIMDf_CAST_TO_FLOAT(hash), closer);\
+				\
+				zcf = SIMDf_ADD(zcf, SIMDf_NUM(1));\
+				zc = SIMDi_ADD(zc, SIMDi_NUM(zPrime));\
+			}\
+			ycf = SIMDf_ADD(ycf, SIMDf_NUM(1));\
+			yc = SIMDi_ADD(yc, SIMDi_NUM(yPrime));\
+		}\
+		xcf = SIMDf_ADD(xcf, SIMDf_NUM(1));\
+		xc = SIMDi_ADD(xc, SIMDi_NUM(xPrime));\
+	}\
+	\
+	cellOut = SIMDi_CAST_TO_INT(cell);\
+}
+
 CELLULAR_VALUE_SINGLE(Euclidean)
 CELLULAR_VALUE_SINGLE(Manhattan)
 CELLULAR_VALUE_SINGLE(Natural)
@@ -2020,8 +3859,22 @@ CELLULAR_LOOKUP_SINGLE(Euclidean)
 CELLULAR_LOOKUP_SINGLE(Manhattan)
 CELLULAR_LOOKUP_SINGLE(Natural)
 
+CELLULAR_CELL_SINGLE(Euclidean)
+CELLULAR_CELL_SINGLE(Manhattan)
+CELLULAR_CELL_SINGLE(Natural)
+
+CELLULAR_VALUE_2D_SINGLE(Euclidean)
+CELLULAR_VALUE_2D_SINGLE(Manhattan)
+CELLULAR_VALUE_2D_SINGLE(Natural)
+
+CELLULAR_LOOKUP_2D_SINGLE(Euclidean)
+CELLULAR_LOOKUP_2D_SINGLE(Manhattan)
+CELLULAR_LOOKUP_2D_SINGLE(Natural)
+
 #undef Natural_DISTANCE
 #define Natural_DISTANCE(_x, _y, _z) SIMDf_MUL(Euclidean_DISTANCE(_x,_y,_z), Manhattan_DISTANCE(_x,_y,_z))
+#undef Natural_DISTANCE_2D
+#define Natural_DISTANCE_2D(_x, _z) SIMDf_MUL(Euclidean_DISTANCE_2D(_x,_z), Manhattan_DISTANCE_2D(_x,_z))
 
 CELLULAR_DISTANCE_SINGLE(Euclidean)
 CELLULAR_DISTANCE_SINGLE(Manhattan)
@@ -2042,6 +3895,25 @@ CELLULAR_DISTANCE2CAVE_SINGLE(Euclidean)
 CELLULAR_DISTANCE2CAVE_SINGLE(Manhattan)
 CELLULAR_DISTANCE2CAVE_SINGLE(Natural)
 
+CELLULAR_DISTANCE_2D_SINGLE(Euclidean)
+CELLULAR_DISTANCE_2D_SINGLE(Manhattan)
+CELLULAR_DISTANCE_2D_SINGLE(Natural)
+
+#define CELLULAR_DISTANCE2_2D_MULTI(returnFunc)\
+CELLULAR_DISTANCE2_2D_SINGLE(Euclidean, returnFunc)\
+CELLULAR_DISTANCE2_2D_SINGLE(Manhattan, returnFunc)\
+CELLULAR_DISTANCE2_2D_SINGLE(Natural, returnFunc)
+
+CELLULAR_DISTANCE2_2D_MULTI(Distance2)
+CELLULAR_DISTANCE2_2D_MULTI(Distance2Add)
+CELLULAR_DISTANCE2_2D_MULTI(Distance2Sub)
+CELLULAR_DISTANCE2_2D_MULTI(Distance2Div)
+CELLULAR_DISTANCE2_2D_MULTI(Distance2Mul)
+
+CELLULAR_DISTANCE2CAVE_2D_SINGLE(Euclidean)
+CELLULAR_DISTANCE2CAVE_2D_SINGLE(Manhattan)
+CELLULAR_DISTANCE2CAVE_2D_SINGLE(Natural)
+
 #define CELLULAR_MULTI(returnFunc)\
 switch(m_cellularDistanceFunction)\
 {\
@@ -2085,6 +3957,7 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
 
 	NoiseLookupSettings nls;
+	NoiseLookupCache lookupCache;
 
 	switch (m_cellularReturnType)
 	{
@@ -2098,19 +3971,129 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 		CELLULAR_INDEX_MULTI(Distance2);
 		break;
 	case Distance2Add:
-		CELLULAR_INDEX_MULTI(Distance2Add);
+		CELLULAR_INDEX_MULTI(Distance2Add);
+		break;
+	case Distance2Sub:
+		CELLULAR_INDEX_MULTI(Distance2Sub);
+		break;
+	case Distance2Mul:
+		CELLULAR_INDEX_MULTI(Distance2Mul);
+		break;
+	case Distance2Div:
+		CELLULAR_INDEX_MULTI(Distance2Div);
+		break;
+	case Distance2Cave:
+		CELLULAR_INDEX_MULTI(Distance2Cave);
+		break;
+	case NoiseLookup:
+		nls.type = m_cellularNoiseLookupType;
+		nls.frequency = SIMDf_SET(m_cellularNoiseLookupFrequency);
+		nls.fractalType = m_fractalType;
+		nls.fractalOctaves = m_octaves;
+		nls.fractalLacunarity = SIMDf_SET(m_lacunarity);
+		nls.fractalGain = SIMDf_SET(m_gain);
+		nls.fractalBounding = SIMDf_SET(m_fractalBounding);
+		nls.fractalOffset = SIMDf_SET(m_fractalOffset);
+		nls.fractalFeedback = SIMDf_SET(m_fractalFeedback);
+		nls.cache = nullptr;
+		if (m_cellularNoiseLookupCache)
+		{
+			lookupCache.Clear();
+			nls.cache = &lookupCache;
+		}
+
+		switch (m_cellularDistanceFunction)
+		{
+		case Euclidean:
+			SET_BUILDER(result = FUNC(CellularLookupEuclideanSingle)(seedV, xF, yF, zF, cellJitterV, nls))
+				break; \
+		case Manhattan:
+			SET_BUILDER(result = FUNC(CellularLookupManhattanSingle)(seedV, xF, yF, zF, cellJitterV, nls))
+				break; \
+		case Natural:
+			SET_BUILDER(result = FUNC(CellularLookupNaturalSingle)(seedV, xF, yF, zF, cellJitterV, nls))
+				break;
+		}
+		break;
+	}
+	SIMD_ZERO_ALL();
+}
+
+#define CELLULAR_MULTI_VECTOR(returnFunc)\
+switch(m_cellularDistanceFunction)\
+{\
+case Euclidean:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##EuclideanSingle)(seedV, xF, yF, zF, cellJitterV))\
+	break;\
+case Manhattan:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##ManhattanSingle)(seedV, xF, yF, zF, cellJitterV))\
+	break;\
+case Natural:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##NaturalSingle)(seedV, xF, yF, zF, cellJitterV))\
+	break;\
+}
+
+#define CELLULAR_INDEX_MULTI_VECTOR(returnFunc)\
+switch(m_cellularDistanceFunction)\
+{\
+case Euclidean:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##EuclideanSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	break;\
+case Manhattan:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##ManhattanSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	break;\
+case Natural:\
+	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##NaturalSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	break;\
+}
+
+void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)
+{
+	assert(noiseSet);
+	assert(vectorSet);
+	assert(vectorSet->size >= 0);
+	SIMD_ZERO_ALL();
+
+	SIMDi seedV = SIMDi_SET(m_seed);
+	SIMDf xFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_zScale);
+	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);
+	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);
+	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);
+	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
+	INIT_PERTURB_VALUES();
+
+	int index = 0;
+	int loopMax = vectorSet->size SIZE_MASK;
+	NoiseLookupSettings nls;
+	NoiseLookupCache lookupCache;
+
+	switch (m_cellularReturnType)
+	{
+	case CellValue:
+		CELLULAR_MULTI_VECTOR(Value);
+		break;
+	case Distance:
+		CELLULAR_MULTI_VECTOR(Distance);
+		break;
+	case Distance2:
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2);
+		break;
+	case Distance2Add:
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2Add);
 		break;
 	case Distance2Sub:
-		CELLULAR_INDEX_MULTI(Distance2Sub);
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2Sub);
 		break;
 	case Distance2Mul:
-		CELLULAR_INDEX_MULTI(Distance2Mul);
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2Mul);
 		break;
 	case Distance2Div:
-		CELLULAR_INDEX_MULTI(Distance2Div);
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2Div);
 		break;
 	case Distance2Cave:
-		CELLULAR_INDEX_MULTI(Distance2Cave);
+		CELLULAR_INDEX_MULTI_VECTOR(Distance2Cave);
 		break;
 	case NoiseLookup:
 		nls.type = m_cellularNoiseLookupType;
@@ -2120,98 +4103,106 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, int xStart, int yStart,
 		nls.fractalLacunarity = SIMDf_SET(m_lacunarity);
 		nls.fractalGain = SIMDf_SET(m_gain);
 		nls.fractalBounding = SIMDf_SET(m_fractalBounding);
+		nls.fractalOffset = SIMDf_SET(m_fractalOffset);
+		nls.fractalFeedback = SIMDf_SET(m_fractalFeedback);
+		nls.cache = nullptr;
+		if (m_cellularNoiseLookupCache)
+		{
+			lookupCache.Clear();
+			nls.cache = &lookupCache;
+		}
 
 		switch (m_cellularDistanceFunction)
 		{
 		case Euclidean:
-			SET_BUILDER(result = FUNC(CellularLookupEuclideanSingle)(seedV, xF, yF, zF, cellJitterV, nls))
-				break; \
+			VECTOR_SET_BUILDER(result = FUNC(CellularLookupEuclideanSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			break;
 		case Manhattan:
-			SET_BUILDER(result = FUNC(CellularLookupManhattanSingle)(seedV, xF, yF, zF, cellJitterV, nls))
-				break; \
+			VECTOR_SET_BUILDER(result = FUNC(CellularLookupManhattanSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			break;
 		case Natural:
-			SET_BUILDER(result = FUNC(CellularLookupNaturalSingle)(seedV, xF, yF, zF, cellJitterV, nls))
-				break;
+			VECTOR_SET_BUILDER(result = FUNC(CellularLookupNaturalSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			break;
 		}
 		break;
 	}
 	SIMD_ZERO_ALL();
 }
 
-#define CELLULAR_MULTI_VECTOR(returnFunc)\
+#define CELLULAR_2D_MULTI(returnFunc)\
 switch(m_cellularDistanceFunction)\
 {\
 case Euclidean:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##EuclideanSingle)(seedV, xF, yF, zF, cellJitterV))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DEuclideanSingle)(seedV, xF, zF, cellJitterV))\
 	break;\
 case Manhattan:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##ManhattanSingle)(seedV, xF, yF, zF, cellJitterV))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DManhattanSingle)(seedV, xF, zF, cellJitterV))\
 	break;\
 case Natural:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##NaturalSingle)(seedV, xF, yF, zF, cellJitterV))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DNaturalSingle)(seedV, xF, zF, cellJitterV))\
 	break;\
 }
 
-#define CELLULAR_INDEX_MULTI_VECTOR(returnFunc)\
+#define CELLULAR_2D_INDEX_MULTI(returnFunc)\
 switch(m_cellularDistanceFunction)\
 {\
 case Euclidean:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##EuclideanSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DEuclideanSingle)(seedV, xF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
 	break;\
 case Manhattan:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##ManhattanSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DManhattanSingle)(seedV, xF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
 	break;\
 case Natural:\
-	VECTOR_SET_BUILDER(result = FUNC(Cellular##returnFunc##NaturalSingle)(seedV, xF, yF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
+	SET_BUILDER(result = FUNC(Cellular##returnFunc##2DNaturalSingle)(seedV, xF, zF, cellJitterV, m_cellularDistanceIndex0, m_cellularDistanceIndex1))\
 	break;\
 }
 
-void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)
+void SIMD_LEVEL_CLASS::FillCellular2DSet(float* noiseSet, int xStart, int zStart, int xSize, int zSize, float scaleModifier)
 {
 	assert(noiseSet);
-	assert(vectorSet);
-	assert(vectorSet->size >= 0);
 	SIMD_ZERO_ALL();
-
 	SIMDi seedV = SIMDi_SET(m_seed);
-	SIMDf xFreqV = SIMDf_SET(m_frequency * m_xScale);
-	SIMDf yFreqV = SIMDf_SET(m_frequency * m_yScale);
-	SIMDf zFreqV = SIMDf_SET(m_frequency * m_zScale);
-	SIMDf xOffsetV = SIMDf_MUL(SIMDf_SET(xOffset), xFreqV);
-	SIMDf yOffsetV = SIMDf_MUL(SIMDf_SET(yOffset), yFreqV);
-	SIMDf zOffsetV = SIMDf_MUL(SIMDf_SET(zOffset), zFreqV);
-	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
 	INIT_PERTURB_VALUES();
 
-	int index = 0;
-	int loopMax = vectorSet->size SIZE_MASK;
+	scaleModifier *= m_frequency;
+
+	// A single row at y = 0, perturb still moves the X/Z sample position
+	int yStart = 0;
+	int ySize = 1;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);
+	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
+
 	NoiseLookupSettings nls;
+	NoiseLookupCache lookupCache;
 
 	switch (m_cellularReturnType)
 	{
 	case CellValue:
-		CELLULAR_MULTI_VECTOR(Value);
+		CELLULAR_2D_MULTI(Value);
 		break;
 	case Distance:
-		CELLULAR_MULTI_VECTOR(Distance);
+		CELLULAR_2D_MULTI(Distance);
 		break;
 	case Distance2:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2);
+		CELLULAR_2D_INDEX_MULTI(Distance2);
 		break;
 	case Distance2Add:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2Add);
+		CELLULAR_2D_INDEX_MULTI(Distance2Add);
 		break;
 	case Distance2Sub:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2Sub);
+		CELLULAR_2D_INDEX_MULTI(Distance2Sub);
 		break;
 	case Distance2Mul:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2Mul);
+		CELLULAR_2D_INDEX_MULTI(Distance2Mul);
 		break;
 	case Distance2Div:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2Div);
+		CELLULAR_2D_INDEX_MULTI(Distance2Div);
 		break;
 	case Distance2Cave:
-		CELLULAR_INDEX_MULTI_VECTOR(Distance2Cave);
+		CELLULAR_2D_INDEX_MULTI(Distance2Cave);
 		break;
 	case NoiseLookup:
 		nls.type = m_cellularNoiseLookupType;
@@ -2221,17 +4212,25 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vect
 		nls.fractalLacunarity = SIMDf_SET(m_lacunarity);
 		nls.fractalGain = SIMDf_SET(m_gain);
 		nls.fractalBounding = SIMDf_SET(m_fractalBounding);
+		nls.fractalOffset = SIMDf_SET(m_fractalOffset);
+		nls.fractalFeedback = SIMDf_SET(m_fractalFeedback);
+		nls.cache = nullptr;
+		if (m_cellularNoiseLookupCache)
+		{
+			lookupCache.Clear();
+			nls.cache = &lookupCache;
+		}
 
 		switch (m_cellularDistanceFunction)
 		{
 		case Euclidean:
-			VECTOR_SET_BUILDER(result = FUNC(CellularLookupEuclideanSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			SET_BUILDER(result = FUNC(CellularLookup2DEuclideanSingle)(seedV, xF, zF, cellJitterV, nls))
 			break;
 		case Manhattan:
-			VECTOR_SET_BUILDER(result = FUNC(CellularLookupManhattanSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			SET_BUILDER(result = FUNC(CellularLookup2DManhattanSingle)(seedV, xF, zF, cellJitterV, nls))
 			break;
 		case Natural:
-			VECTOR_SET_BUILDER(result = FUNC(CellularLookupNaturalSingle)(seedV, xF, yF, zF, cellJitterV, nls));
+			SET_BUILDER(result = FUNC(CellularLookup2DNaturalSingle)(seedV, xF, zF, cellJitterV, nls))
 			break;
 		}
 		break;
@@ -2239,6 +4238,92 @@ void SIMD_LEVEL_CLASS::FillCellularSet(float* noiseSet, FastNoiseVectorSet* vect
 	SIMD_ZERO_ALL();
 }
 
+#ifdef FN_ALIGNED_SETS
+#define CELL_SET_STORE(_set, _source) SIMDf_STORE(&(_set)[index], _source)
+#else
+#define CELL_SET_STORE(_set, _source)\
+if (index + VECTOR_SIZE <= maxIndex) SIMDf_STORE(&(_set)[index], _source);\
+else { SIMDf _last = _source; std::memcpy(&(_set)[index], &_last, (maxIndex - index) * 4); }
+#endif
+
+#define CELL_SET_BUILDER(distanceFunc)\
+{\
+	SIMDi ySizeV = SIMDi_SET(ySize);\
+	SIMDi zSizeV = SIMDi_SET(zSize);\
+	\
+	SIMDi yEndV = SIMDi_SET(yStart + ySize - 1);\
+	SIMDi zEndV = SIMDi_SET(zStart + zSize - 1);\
+	\
+	SIMDi x = SIMDi_SET(xStart);\
+	SIMDi y = SIMDi_SET(yStart);\
+	SIMDi z = SIMDi_ADD(SIMDi_SET(zStart), SIMDi_NUM(incremental));\
+	AXIS_RESET(zSize, 1)\
+	\
+	int maxIndex = xSize * ySize * zSize;\
+	\
+	for (int index = 0; index < maxIndex; index += VECTOR_SIZE)\
+	{\
+		SIMDf xF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(x), xFreqV);\
+		SIMDf yF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(y), yFreqV);\
+		SIMDf zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);\
+		\
+		PERTURB_SWITCH()\
+		SIMDi cell;\
+		SIMDf point[3], point2[3];\
+		FUNC(CellularCell##distanceFunc##Single)(seedV, xF, yF, zF, cellJitterV, cell, point, point2);\
+		\
+		CELL_SET_STORE(reinterpret_cast<float*>(cellSet), SIMDf_CAST_TO_FLOAT(cell));\
+		if (pointSet)\
+		{\
+			CELL_SET_STORE(pointSet, SIMDf_DIV(point[0], xFreqV));\
+			CELL_SET_STORE(pointSet + planeSize, SIMDf_DIV(point[1], yFreqV));\
+			CELL_SET_STORE(pointSet + planeSize * 2, SIMDf_DIV(point[2], zFreqV));\
+		}\
+		if (point2Set)\
+		{\
+			CELL_SET_STORE(point2Set, SIMDf_DIV(point2[0], xFreqV));\
+			CELL_SET_STORE(point2Set + planeSize, SIMDf_DIV(point2[1], yFreqV));\
+			CELL_SET_STORE(point2Set + planeSize * 2, SIMDf_DIV(point2[2], zFreqV));\
+		}\
+		\
+		z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));\
+		\
+		AXIS_RESET(zSize, 0)\
+	}\
+}
+
+void SIMD_LEVEL_CLASS::FillCellularCellSet(int* cellSet, float* pointSet, float* point2Set, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	assert(cellSet);
+	SIMD_ZERO_ALL();
+	SIMDi seedV = SIMDi_SET(m_seed);
+	INIT_PERTURB_VALUES();
+
+	scaleModifier *= m_frequency;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale);
+	SIMDf cellJitterV = SIMDf_SET(m_cellularJitter);
+
+	// Points are stored as SoA, laid out like FastNoiseVectorSet
+	int planeSize = AlignedSize(xSize * ySize * zSize);
+
+	switch (m_cellularDistanceFunction)
+	{
+	case Euclidean:
+		CELL_SET_BUILDER(Euclidean)
+		break;
+	case Manhattan:
+		CELL_SET_BUILDER(Manhattan)
+		break;
+	case Natural:
+		CELL_SET_BUILDER(Natural)
+		break;
+	}
+	SIMD_ZERO_ALL();
+}
+
 #define SAMPLE_INDEX(_x,_y,_z) ((_x) * yzSizeSample + (_y) * zSizeSample + (_z))
 #define SET_INDEX(_x,_y,_z) ((_x) * yzSize + (_y) * zSize + (_z))
 
@@ -2524,5 +4609,373 @@ void SIMD_LEVEL_CLASS::FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet*
 	SIMD_ZERO_ALL();
 }
 
+// Interpolation weights for rows a, b, c, d at t between rows b and c
+static int FUNC(SampleWeights)(_FastNoiseSIMD::SampleInterp sampleInterp, int local, float ratioInv, float* weights)
+{
+	float t = local * ratioInv;
+
+	if (local == 0)
+		return 1;
+
+	switch (sampleInterp)
+	{
+	case _FastNoiseSIMD::CatmullRom:
+		weights[0] = 0.5f * t * ((2.0f - t) * t - 1.0f);
+		weights[1] = 0.5f * (t * t * (3.0f * t - 5.0f) + 2.0f);
+		weights[2] = 0.5f * t * ((4.0f - 3.0f * t) * t + 1.0f);
+		weights[3] = 0.5f * t * t * (t - 1.0f);
+		return 4;
+	default:
+		weights[2] = t;
+		return 2;
+	}
+}
+
+// Interpolates a row from the rows around it, taps from FUNC(SampleWeights)
+static void FUNC(SampleRow)(float* out, const float* a, const float* b, const float* c, const float* d, const float* weights, int taps, int size)
+{
+	int vectorSize = size & ~(VECTOR_SIZE - 1);
+	int i = 0;
+
+	switch (taps)
+	{
+	case 1:
+		for (; i < vectorSize; i += VECTOR_SIZE)
+			SIMDf_STORE_UNALIGNED(&out[i], SIMDf_LOAD(&b[i]));
+
+		for (; i < size; i++)
+			out[i] = b[i];
+		break;
+	case 2:
+	{
+		SIMDf t = SIMDf_SET(weights[2]);
+
+		for (; i < vectorSize; i += VECTOR_SIZE)
+			SIMDf_STORE_UNALIGNED(&out[i], FUNC(Lerp)(SIMDf_LOAD(&b[i]), SIMDf_LOAD(&c[i]), t));
+
+		for (; i < size; i++)
+			out[i] = (c[i] - b[i]) * weights[2] + b[i];
+		break;
+	}
+	case 4:
+	{
+		SIMDf w0 = SIMDf_SET(weights[0]);
+		SIMDf w1 = SIMDf_SET(weights[1]);
+		SIMDf w2 = SIMDf_SET(weights[2]);
+		SIMDf w3 = SIMDf_SET(weights[3]);
+
+		for (; i < vectorSize; i += VECTOR_SIZE)
+			SIMDf_STORE_UNALIGNED(&out[i], SIMDf_MUL_ADD(SIMDf_LOAD(&d[i]), w3, SIMDf_MUL_ADD(SIMDf_LOAD(&c[i]), w2,
+				SIMDf_MUL_ADD(SIMDf_LOAD(&b[i]), w1, SIMDf_MUL(SIMDf_LOAD(&a[i]), w0)))));
+
+		for (; i < size; i++)
+			out[i] = d[i] * weights[3] + c[i] * weights[2] + b[i] * weights[1] + a[i] * weights[0];
+		break;
+	}
+	}
+}
+
+// Interpolates a coarse grid sampled at multiples of the ratios to the full set, see GetSampledGrid() for the grid
+// zPassSet must hold xGridSize * yGridSize * AlignedSize(zSize) floats and yPassSet xGridSize * ySize * AlignedSize(zSize)
+static void FUNC(UpsampleGrid)(float* noiseSet, const float* gridSet, float* zPassSet, float* yPassSet, _FastNoiseSIMD::SampleInterp sampleInterp,
+	int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio,
+	int xGridStart, int yGridStart, int zGridStart, int xGridSize, int yGridSize, int zGridSize)
+{
+	// Catmull-Rom grids have an extra sample on each side
+	int apron = sampleInterp == _FastNoiseSIMD::CatmullRom ? 1 : 0;
+	int zPitch = _FastNoiseSIMD::AlignedSize(zSize);
+	float weights[4];
+
+	// Z pass, coarse rows to full z rows
+	float zRatioInv = 1.0f / zRatio;
+	int zLocalStart = zStart - (zGridStart + apron) * zRatio;
+
+	for (int row = 0; row < xGridSize * yGridSize; row++)
+	{
+		const float* gridRow = gridSet + row * zGridSize;
+		float* zPassRow = zPassSet + row * zPitch;
+		int zLocal = zLocalStart;
+		int zGrid = apron;
+
+		for (int z = 0; z < zSize; z++)
+		{
+			const float* g = gridRow + zGrid;
+
+			switch (FUNC(SampleWeights)(sampleInterp, zLocal, zRatioInv, weights))
+			{
+			case 1:
+				zPassRow[z] = g[0];
+				break;
+			case 2:
+				zPassRow[z] = (g[1] - g[0]) * weights[2] + g[0];
+				break;
+			case 4:
+				zPassRow[z] = g[2] * weights[3] + g[1] * weights[2] + g[0] * weights[1] + g[-1] * weights[0];
+				break;
+			}
+
+			if (++zLocal == zRatio)
+			{
+				zLocal = 0;
+				zGrid++;
+			}
+		}
+		for (int z = zSize; z < zPitch; z++)
+			zPassRow[z] = 0.0f;
+	}
+
+	// Y pass, coarse y to full y for each coarse x
+	float yRatioInv = 1.0f / yRatio;
+	int yLocalStart = yStart - (yGridStart + apron) * yRatio;
+
+	for (int xGrid = 0; xGrid < xGridSize; xGrid++)
+	{
+		float* yPassRow = yPassSet + xGrid * ySize * zPitch;
+		int yLocal = yLocalStart;
+		int yGrid = apron;
+
+		for (int y = 0; y < ySize; y++)
+		{
+			float* b = zPassSet + (xGrid * yGridSize + yGrid) * zPitch;
+			int taps = FUNC(SampleWeights)(sampleInterp, yLocal, yRatioInv, weights);
+
+			FUNC(SampleRow)(yPassRow, b - zPitch, b, b + zPitch, b + zPitch * 2, weights, taps, zPitch);
+			yPassRow += zPitch;
+
+			if (++yLocal == yRatio)
+			{
+				yLocal = 0;
+				yGrid++;
+			}
+		}
+	}
+
+	// X pass, coarse x to the full set
+	float xRatioInv = 1.0f / xRatio;
+	int xLocal = xStart - (xGridStart + apron) * xRatio;
+	int xGrid = apron;
+	int xPitch = ySize * zPitch;
+	float* setRow = noiseSet;
+
+	for (int x = 0; x < xSize; x++)
+	{
+		float* b = yPassSet + xGrid * xPitch;
+		int taps = FUNC(SampleWeights)(sampleInterp, xLocal, xRatioInv, weights);
+
+		for (int y = 0; y < ySize; y++)
+		{
+			FUNC(SampleRow)(setRow, b - xPitch, b, b + xPitch, b + xPitch * 2, weights, taps, zSize);
+			b += zPitch;
+			setRow += zSize;
+		}
+
+		if (++xLocal == xRatio)
+		{
+			xLocal = 0;
+			xGrid++;
+		}
+	}
+}
+
+void SIMD_LEVEL_CLASS::FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio, float* scratchSet, float scaleModifier)
+{
+	assert(noiseSet);
+	assert(scratchSet);
+	assert(xRatio > 0 && yRatio > 0 && zRatio > 0);
+	SIMD_ZERO_ALL();
+
+	// Catmull-Rom needs an extra sample on each side
+	int apron = m_sampleInterp == CatmullRom ? 1 : 0;
+	int xGridStart, yGridStart, zGridStart;
+	int xGridSize, yGridSize, zGridSize;
+
+	GetSampledGrid(xStart, xSize, xRatio, apron, xGridStart, xGridSize);
+	GetSampledGrid(yStart, ySize, yRatio, apron, yGridStart, yGridSize);
+	GetSampledGrid(zStart, zSize, zRatio, apron, zGridStart, zGridSize);
+
+	int gridSize = xGridSize * yGridSize * zGridSize;
+	int gridAligned = AlignedSize(gridSize);
+	int zPitch = AlignedSize(zSize);
+
+	// Coarse grid positions are placed in the scratch set after the coarse noise
+	float* gridSet = scratchSet;
+	FastNoiseVectorSet vectorSet;
+	vectorSet.size = gridSize;
+	vectorSet.scaleModifier = scaleModifier;
+	vectorSet.xSet = gridSet + gridAligned;
+	vectorSet.ySet = vectorSet.xSet + gridAligned;
+	vectorSet.zSet = vectorSet.ySet + gridAligned;
+
+	int index = 0;
+	for (int ix = 0; ix < xGridSize; ix++)
+	{
+		for (int iy = 0; iy < yGridSize; iy++)
+		{
+			for (int iz = 0; iz < zGridSize; iz++)
+			{
+				vectorSet.xSet[index] = float((xGridStart + ix) * xRatio);
+				vectorSet.ySet[index] = float((yGridStart + iy) * yRatio);
+				vectorSet.zSet[index] = float((zGridStart + iz) * zRatio);
+				index++;
+			}
+		}
+	}
+
+	FillNoiseSet(gridSet, &vectorSet);
+
+	// Scratch set memory isn't owned by the vector set
+	vectorSet.xSet = nullptr;
+	vectorSet.ySet = nullptr;
+	vectorSet.zSet = nullptr;
+
+	float* zPassSet = gridSet + gridAligned * 4;
+	float* yPassSet = zPassSet + xGridSize * yGridSize * zPitch;
+
+	FUNC(UpsampleGrid)(noiseSet, gridSet, zPassSet, yPassSet, m_sampleInterp, xStart, yStart, zStart, xSize, ySize, zSize, xRatio, yRatio, zRatio,
+		xGridStart, yGridStart, zGridStart, xGridSize, yGridSize, zGridSize);
+	SIMD_ZERO_ALL();
+}
+
+// Perturbs a grid spaced ratio values apart, coordinates are stored in set units of the full set
+void SIMD_LEVEL_CLASS::FillWarpedGrid(float* xSet, float* ySet, float* zSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int ratio, float scaleModifier)
+{
+	SIMDi seedV = SIMDi_SET(m_seed);
+	INIT_PERTURB_VALUES();
+
+	int maxIndex = xSize * ySize * zSize;
+
+	scaleModifier *= m_frequency;
+
+	SIMDf xFreqV = SIMDf_SET(scaleModifier * m_xScale * ratio);
+	SIMDf yFreqV = SIMDf_SET(scaleModifier * m_yScale * ratio);
+	SIMDf zFreqV = SIMDf_SET(scaleModifier * m_zScale * ratio);
+	SIMDf xSetFreqV = SIMDf_SET(scaleModifier * m_xScale);
+	SIMDf ySetFreqV = SIMDf_SET(scaleModifier * m_yScale);
+	SIMDf zSetFreqV = SIMDf_SET(scaleModifier * m_zScale);
+
+	SIMDi ySizeV = SIMDi_SET(ySize);
+	SIMDi zSizeV = SIMDi_SET(zSize);
+
+	SIMDi yEndV = SIMDi_SET(yStart + ySize - 1);
+	SIMDi zEndV = SIMDi_SET(zStart + zSize - 1);
+
+	SIMDi x = SIMDi_SET(xStart);
+	SIMDi y = SIMDi_SET(yStart);
+	SIMDi z = SIMDi_ADD(SIMDi_SET(zStart), SIMDi_NUM(incremental));
+	AXIS_RESET(zSize, 1)
+
+	for (int index = 0; index < maxIndex; index += VECTOR_SIZE)
+	{
+		SIMDf xF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(x), xFreqV);
+		SIMDf yF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(y), yFreqV);
+		SIMDf zF = SIMDf_MUL(SIMDf_CONVERT_TO_FLOAT(z), zFreqV);
+
+		PERTURB_SWITCH()
+
+		CELL_SET_STORE(xSet, SIMDf_DIV(xF, xSetFreqV));
+		CELL_SET_STORE(ySet, SIMDf_DIV(yF, ySetFreqV));
+		CELL_SET_STORE(zSet, SIMDf_DIV(zF, zSetFreqV));
+
+		z = SIMDi_ADD(z, SIMDi_NUM(vectorSize));
+
+		AXIS_RESET(zSize, 0)
+	}
+}
+
+void SIMD_LEVEL_CLASS::FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier)
+{
+	assert(warpedSet);
+	SIMD_ZERO_ALL();
+
+	int size = xSize * ySize * zSize;
+
+	// Keep the allocation when a set is reused for chunks of the same size
+	if (warpedSet->size != size)
+		warpedSet->SetSize(size);
+	warpedSet->sampleScale = 0;
+	warpedSet->warped = true;
+	warpedSet->scaleModifier = scaleModifier;
+
+	int ratio = m_perturbSampleRatio;
+
+	if (ratio <= 1 || m_perturbType == None)
+	{
+		FillWarpedGrid(warpedSet->xSet, warpedSet->ySet, warpedSet->zSet, xStart, yStart, zStart, xSize, ySize, zSize, 1, scaleModifier);
+		SIMD_ZERO_ALL();
+		return;
+	}
+
+	// Perturb on a coarse grid, unperturbed coordinates are linear so they are interpolated exactly along with the warp
+	int xGridStart, yGridStart, zGridStart;
+	int xGridSize, yGridSize, zGridSize;
+
+	GetSampledGrid(xStart, xSize, ratio, 0, xGridStart, xGridSize);
+	GetSampledGrid(yStart, ySize, ratio, 0, yGridStart, yGridSize);
+	GetSampledGrid(zStart, zSize, ratio, 0, zGridStart, zGridSize);
+
+	int gridAligned = AlignedSize(xGridSize * yGridSize * zGridSize);
+	int zPitch = AlignedSize(zSize);
+
+	float* gridSet = GetEmptySet(gridAligned * 3 + (xGridSize * yGridSize + xGridSize * ySize) * zPitch);
+	float* zPassSet = gridSet + gridAligned * 3;
+	float* yPassSet = zPassSet + xGridSize * yGridSize * zPitch;
+
+	FillWarpedGrid(gridSet, gridSet + gridAligned, gridSet + gridAligned * 2, xGridStart, yGridStart, zGridStart, xGridSize, yGridSize, zGridSize, ratio, scaleModifier);
+
+	float* warpedAxes[3] = { warpedSet->xSet, warpedSet->ySet, warpedSet->zSet };
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		FUNC(UpsampleGrid)(warpedAxes[axis], gridSet + gridAligned * axis, zPassSet, yPassSet, Linear, xStart, yStart, zStart, xSize, ySize, zSize, ratio, ratio, ratio,
+			xGridStart, yGridStart, zGridStart, xGridSize, yGridSize, zGridSize);
+	}
+
+	FreeNoiseSet(gridSet);
+	SIMD_ZERO_ALL();
+}
+
+void SIMD_LEVEL_CLASS::FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, FastNoiseVectorSet* vectorSet, float xOffset, float yOffset, float zOffset)
+{
+	assert(warpedSet);
+	assert(vectorSet);
+	assert(vectorSet->size >= 0);
+	SIMD_ZERO_ALL();
+	SIMDi seedV = SIMDi_SET(m_seed);
+	INIT_PERTURB_VALUES();
+
+	int maxIndex = vectorSet->size;
+
+	if (warpedSet != vectorSet && warpedSet->size != maxIndex)
+		warpedSet->SetSize(maxIndex);
+	warpedSet->sampleScale = 0;
+	warpedSet->warped = true;
+	warpedSet->scaleModifier = vectorSet->scaleModifier;
+
+	SIMDf xFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_xScale);
+	SIMDf yFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_yScale);
+	SIMDf zFreqV = SIMDf_SET(vectorSet->scaleModifier * m_frequency * m_zScale);
+	SIMDf xOffsetV = SIMDf_SET(xOffset);
+	SIMDf yOffsetV = SIMDf_SET(yOffset);
+	SIMDf zOffsetV = SIMDf_SET(zOffset);
+	SIMDf xOffsetFreqV = SIMDf_MUL(xOffsetV, xFreqV);
+	SIMDf yOffsetFreqV = SIMDf_MUL(yOffsetV, yFreqV);
+	SIMDf zOffsetFreqV = SIMDf_MUL(zOffsetV, zFreqV);
+
+	// Points are sampled like FillNoiseSet with a vector set, then the offset is taken off again so the warped points stay in the same space
+	for (int index = 0; index < maxIndex; index += VECTOR_SIZE)
+	{
+		SIMDf xF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->xSet[index]), xFreqV, xOffsetFreqV);
+		SIMDf yF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->ySet[index]), yFreqV, yOffsetFreqV);
+		SIMDf zF = SIMDf_MUL_ADD(SIMDf_LOAD(&vectorSet->zSet[index]), zFreqV, zOffsetFreqV);
+
+		PERTURB_SWITCH()
+
+		CELL_SET_STORE(warpedSet->xSet, SIMDf_SUB(SIMDf_DIV(xF, xFreqV), xOffsetV));
+		CELL_SET_STORE(warpedSet->ySet, SIMDf_SUB(SIMDf_DIV(yF, yFreqV), yOffsetV));
+		CELL_SET_STORE(warpedSet->zSet, SIMDf_SUB(SIMDf_DIV(zF, zFreqV), zOffsetV));
+	}
+	SIMD_ZERO_ALL();
+}
+
 #undef SIMD_LEVEL
 #endif
@@ -37,17 +37,22 @@ namespace FastNoiseSIMD_internal
 	class FASTNOISE_SIMD_CLASS(SIMD_LEVEL_H) : public _FastNoiseSIMD
 	{
 	public:
-		// Do not call this, use SetSIMDLevel(int) to have NewFastNoiseSIMD() return the level you want
+		// Do not call this, use NewFastNoiseSIMD(seed, level) to get the level you want
 		FASTNOISE_SIMD_CLASS(SIMD_LEVEL_H)(int seed = 1337);
 
-		static float* GetEmptySet(int size);
-		static int AlignedSize(int size);
+		// Floats processed per SIMD vector, sets are padded to a multiple of this
+		static int VectorSize();
+
+		void FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
+		void FillWarpedVectorSet(FastNoiseVectorSet* warpedSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
 
 		void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int sampleScale) override;
 		void FillSampledNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
+		void FillSampledNoiseSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int xRatio, int yRatio, int zRatio, float* scratchSet, float scaleModifier = 1.0f) override;
 
 		void FillWhiteNoiseSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillWhiteNoiseSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
+		void FillTileHashSet(int* hashSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize) override;
 
 		void FillValueSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillValueFractalSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
@@ -66,11 +71,23 @@ namespace FastNoiseSIMD_internal
 
 		void FillCellularSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillCellularSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
+		void FillCellular2DSet(float* noiseSet, int xStart, int zStart, int xSize, int zSize, float scaleModifier = 1.0f) override;
+		void FillCellularCellSet(int* cellSet, float* pointSet, float* point2Set, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 
 		void FillCubicSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillCubicFractalSet(float* floatSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float scaleModifier = 1.0f) override;
 		void FillCubicSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
 		void FillCubicFractalSet(float* noiseSet, FastNoiseVectorSet* vectorSet, float xOffset = 0.0f, float yOffset = 0.0f, float zOffset = 0.0f) override;
+
+		void ConvertToHalf(uint16_t* halfSet, const float* floatSet, int size) override;
+		void FillNormalsFromHeights(uint8_t* normalMap, const float* heightSet, int heightStride, int xSize, int zSize, float strength, NormalMapFormat format = RGBA8) override;
+		void ConvertToHeights(float* heightSet, const float* floatSet, int size, float heightScale, float heightBias, float& minOut, float& maxOut) override;
+
+		void FillThresholdSet(float* noiseSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float isoLevel, float scaleModifier = 1.0f) override;
+		bool GetNoiseBounds(int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, float& minOut, float& maxOut, float scaleModifier = 1.0f) override;
+
+	private:
+		void FillWarpedGrid(float* xSet, float* ySet, float* zSet, int xStart, int yStart, int zStart, int xSize, int ySize, int zSize, int ratio, float scaleModifier);
 	};
 }
 #undef SIMD_LEVEL_H